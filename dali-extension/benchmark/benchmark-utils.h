@@ -0,0 +1,133 @@
+#ifndef DALI_EXTENSION_BENCHMARK_UTILS_H
+#define DALI_EXTENSION_BENCHMARK_UTILS_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace Dali
+{
+namespace Benchmark
+{
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief The summary of the samples of one measurement.
+ */
+struct Statistics
+{
+  double mean{0.0};
+  double median{0.0};
+  double p95{0.0};
+  double max{0.0};
+};
+
+/**
+ * @brief Returns the milliseconds from the given time point until now.
+ */
+inline double ElapsedMilliseconds(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Sorts the samples and returns their mean, median, 95th percentile and maximum.
+ */
+inline Statistics GetStatistics(std::vector<double> samples)
+{
+  Statistics statistics;
+  if(samples.empty())
+  {
+    return statistics;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  double sum = 0.0;
+  for(double sample : samples)
+  {
+    sum += sample;
+  }
+  statistics.mean   = sum / static_cast<double>(samples.size());
+  statistics.median = samples[samples.size() / 2u];
+  statistics.p95    = samples[std::min(samples.size() - 1u, samples.size() * 95u / 100u)];
+  statistics.max    = samples.back();
+  return statistics;
+}
+
+/**
+ * @brief Returns the value of an option like "--name=value", or nullptr if the argument is not the given option.
+ */
+inline const char* GetOptionValue(const char* argument, const char* name)
+{
+  const size_t length = std::strlen(name);
+  if(std::strncmp(argument, name, length) != 0 || argument[length] != '=')
+  {
+    return nullptr;
+  }
+  return argument + length + 1u;
+}
+
+/**
+ * @brief Parses a whole text as a decimal number, which must not be zero unless allowZero is set.
+ */
+inline bool ParseUnsigned(const char* text, uint32_t& value, bool allowZero = false)
+{
+  char*               end    = nullptr;
+  const unsigned long parsed = std::strtoul(text, &end, 10);
+  if(end == text || *end != '\0' || (parsed == 0u && !allowZero))
+  {
+    return false;
+  }
+  value = static_cast<uint32_t>(parsed);
+  return true;
+}
+
+/**
+ * @brief Parses a comma separated list of non zero numbers, replacing the values.
+ */
+inline bool ParseUnsignedList(const char* text, std::vector<uint32_t>& values)
+{
+  values.clear();
+  const std::string list(text);
+  size_t            start = 0u;
+  while(start < list.size())
+  {
+    const size_t end = std::min(list.find(',', start), list.size());
+    uint32_t     value;
+    if(!ParseUnsigned(list.substr(start, end - start).c_str(), value))
+    {
+      return false;
+    }
+    values.push_back(value);
+    start = end + 1u;
+  }
+  return true;
+}
+
+} // namespace Benchmark
+
+} // namespace Dali
+
+#endif // DALI_EXTENSION_BENCHMARK_UTILS_H
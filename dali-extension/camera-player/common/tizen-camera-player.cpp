@@ -43,8 +43,6 @@ namespace Plugin
 namespace
 {
 
-const int TIMER_INTERVAL(20);
-
 static void MediaPacketCameraPreviewCb(media_packet_h packet, void* user_data)
 {
   TizenCameraPlayer* player = static_cast<TizenCameraPlayer*>(user_data);
@@ -58,6 +56,27 @@ static void MediaPacketCameraPreviewCb(media_packet_h packet, void* user_data)
   player->PushPacket(packet);
 }
 
+void DestroyMediaPacket(void* packet)
+{
+  int error = media_packet_destroy(static_cast<media_packet_h>(packet));
+  if(error != MEDIA_PACKET_ERROR_NONE)
+  {
+    DALI_LOG_ERROR("Media packet destroy error: %d\n", error);
+  }
+}
+
+Any GetSurfaceFromPacket(void* packet)
+{
+  tbm_surface_h tbmSurface = NULL;
+  int           error      = media_packet_get_tbm_surface(static_cast<media_packet_h>(packet), &tbmSurface);
+  if(error != MEDIA_PACKET_ERROR_NONE)
+  {
+    DALI_LOG_ERROR("media_packet_get_tbm_surface error: %d\n", error);
+    return Any();
+  }
+  return Any(tbmSurface);
+}
+
 } // unnamed namespace
 
 void CameraPlayerError(int error, const char* function, int line)
@@ -143,13 +162,10 @@ void CameraPlayerError(int error, const char* function, int line)
 TizenCameraPlayer::TizenCameraPlayer()
 : mCameraPlayer(NULL),
   mCameraPlayerState(CAMERA_STATE_NONE),
-  mTbmSurface(NULL),
-  mPacket(NULL),
   mNativeImagePtr(NULL),
-  mTimer(),
+  mEventCallback(),
   mBackgroundColor(Dali::Vector4(1.0f, 1.0f, 1.0f, 0.0f)),
-  mPacketMutex(),
-  mPacketVector(),
+  mFrameQueue(DestroyMediaPacket, GetSurfaceFromPacket, MediaFrameQueue::DropPolicy::KEEP_LATEST),
 #ifdef USE_TCORE_BACKEND
   mTcoreWlWindow(nullptr)
 #else
@@ -200,27 +216,27 @@ void TizenCameraPlayer::StopPreview()
     int error = camera_stop_preview(mCameraPlayer);
     CameraPlayerError(error, __FUNCTION__, __LINE__);
 
-    if(mNativeImagePtr && mTimer)
+    if(mNativeImagePtr && mEventCallback)
     {
-      mTimer.Stop();
-      DestroyPackets();
+      mFrameQueue.Clear();
     }
   }
 }
 
 void TizenCameraPlayer::Destroy()
 {
-  if(mNativeImagePtr && mTimer)
+  if(mNativeImagePtr && mEventCallback)
   {
-    mTimer.Stop();
-    DestroyPackets();
-
+    // Unset the preview callback first, so no packet is pushed after they are destroyed.
     GetPlayerState(&mCameraPlayerState);
     if(mCameraPlayerState != CAMERA_STATE_NONE)
     {
       int error = camera_unset_media_packet_preview_cb(mCameraPlayer);
       CameraPlayerError(error, __FUNCTION__, __LINE__);
     }
+
+    mFrameQueue.Clear();
+    mEventCallback.reset();
   }
 }
 
@@ -249,15 +265,17 @@ void TizenCameraPlayer::InitializeTextureStreamMode(Dali::NativeImagePtr nativeI
 
   if(mCameraPlayerState == CAMERA_STATE_CREATED && mNativeImagePtr)
   {
+    if(!mEventCallback)
+    {
+      mEventCallback = std::unique_ptr<Dali::EventThreadCallback>(new Dali::EventThreadCallback(MakeCallback(this, &TizenCameraPlayer::Update)));
+    }
+
     error = camera_set_media_packet_preview_cb(mCameraPlayer, MediaPacketCameraPreviewCb, this);
     CameraPlayerError(error, __FUNCTION__, __LINE__);
 
     error = camera_set_display(mCameraPlayer, CAMERA_DISPLAY_TYPE_NONE, NULL);
     CameraPlayerError(error, __FUNCTION__, __LINE__);
 
-    mTimer = Dali::Timer::New(TIMER_INTERVAL);
-    mTimer.TickSignal().Connect(this, &TizenCameraPlayer::Update);
-    mTimer.Start();
 
     if(isPlay)
     {
@@ -267,81 +285,27 @@ void TizenCameraPlayer::InitializeTextureStreamMode(Dali::NativeImagePtr nativeI
   }
 }
 
-bool TizenCameraPlayer::Update()
+void TizenCameraPlayer::Update()
 {
-  int error;
-
-  if(mPacket != NULL)
-  {
-    error = media_packet_destroy(mPacket);
-    if(error != MEDIA_PACKET_ERROR_NONE)
-    {
-      DALI_LOG_ERROR("Media packet destroy error: %d\n", error);
-    }
-    mPacket = NULL;
-  }
-
+  // Only the newest frame is displayed, and the older ones are dropped. The displayed packets are retained by the queue.
+  Any source = mFrameQueue.Present();
+  if(source.Empty() || !mNativeImagePtr)
   {
-    Dali::Mutex::ScopedLock lock(mPacketMutex);
-
-    if(!mPacketVector.empty())
-    {
-      mPacket = mPacketVector.front();
-      mPacketVector.pop_front();
-    }
-  }
-
-  if(mPacket == NULL)
-  {
-    return true;
-  }
-
-  error = media_packet_get_tbm_surface(mPacket, &mTbmSurface);
-  if(error != MEDIA_PACKET_ERROR_NONE)
-  {
-    media_packet_destroy(mPacket);
-    mPacket = NULL;
-    DALI_LOG_ERROR("error: %d\n", error);
-    return true;
+    return;
   }
 
-  Any source(mTbmSurface);
   mNativeImagePtr->SetSource(source);
   Dali::Adaptor::Get().RequestProcessEventsAndUpdate();
-
-  return true;
 }
 
-void TizenCameraPlayer::DestroyPackets()
+void TizenCameraPlayer::PushPacket(media_packet_h packet)
 {
-  int error;
-  if(mPacket != NULL)
-  {
-    error = media_packet_destroy(mPacket);
-    DALI_LOG_ERROR("Media packet destroy error: %d\n", error);
-    mPacket = NULL;
-  }
-
+  // Update() takes all the queued packets, so a trigger is pending already if the queue was not empty.
+  if(mFrameQueue.Push(packet) && mEventCallback)
   {
-    Dali::Mutex::ScopedLock lock(mPacketMutex);
-    while(!mPacketVector.empty())
-    {
-      mPacket = mPacketVector.front();
-      error   = media_packet_destroy(mPacket);
-      DALI_LOG_ERROR("Media packet destroy error: %d\n", error);
-      mPacketVector.pop_front();
-      mPacket = NULL;
-    }
-    mPacketVector.clear();
+    mEventCallback->Trigger();
   }
 }
 
-void TizenCameraPlayer::PushPacket(media_packet_h packet)
-{
-  Dali::Mutex::ScopedLock lock(mPacketMutex);
-
-  mPacketVector.push_back(packet);
-}
-
 } // namespace Plugin
 } // namespace Dali
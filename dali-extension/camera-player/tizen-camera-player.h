@@ -21,10 +21,10 @@
 // EXTERNAL INCLUDES
 #include <camera.h>
 #include <dali/devel-api/adaptor-framework/camera-player-plugin.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/public-api/adaptor-framework/native-image.h>
-#include <dali/public-api/adaptor-framework/timer.h>
-#include <deque>
+#include <memory>
 #include <string>
 
 #ifndef HAVE_WAYLAND
@@ -37,6 +37,9 @@
 #endif
 #include <camera_internal.h>
 
+// INTERNAL INCLUDES
+#include "../integration-api/media-frame-queue.h"
+
 namespace Dali
 {
 namespace Plugin
@@ -83,26 +86,22 @@ public:
 
   /**
    * @brief Push media packet with camera frame image
+   * @note This is called in the camera thread. The event thread is woken up only when the queue was empty.
    */
   void PushPacket(media_packet_h packet);
 
 private:
   /**
-   * @brief Updates camera frame image by timer if rendering targe is native
-   * image source
+   * @brief Updates camera frame image in the event thread if rendering target is native
+   * image source. Only the newest packet is displayed, and the older ones are dropped.
    */
-  bool Update();
+  void Update();
 
   /**
    * @brief Gets current player state
    */
   void GetPlayerState(camera_state_e* state) const;
 
-  /**
-   * @brief Destroy all packests, which this plugin stores
-   */
-  void DestroyPackets();
-
   /**
    * @brief Initializes player for camera rendering using native image
    */
@@ -132,17 +131,12 @@ private:
   camera_h       mCameraPlayer;      ///< Camera handle
   camera_state_e mCameraPlayerState; ///< State of Camera Player
 
-  tbm_surface_h  mTbmSurface; ///< tbm surface handle
-  media_packet_h mPacket;     ///< Media packet handle with tbm surface of current camera frame image
-
-  Dali::NativeImagePtr mNativeImagePtr;  ///< native image for camera rendering
-  Dali::Timer          mTimer;           ///< Timer for texture streaming rendering
-  Dali::Vector4        mBackgroundColor; ///< Current background color, which
-                                         ///< texturestream mode needs.
-
-  Dali::Mutex mPacketMutex;
+  Dali::NativeImagePtr                       mNativeImagePtr;  ///< native image for camera rendering
+  std::unique_ptr<Dali::EventThreadCallback> mEventCallback;   ///< Callback to update the camera frame image in the event thread
+  Dali::Vector4                              mBackgroundColor; ///< Current background color, which
+                                                               ///< texturestream mode needs.
 
-  std::deque<media_packet_h> mPacketVector; ///< Container for media packet handle from Tizen player callback
+  MediaFrameQueue mFrameQueue; ///< Media packets from the camera preview callback, pending and recently displayed
 
 #ifdef USE_TCORE_BACKEND
   tizen_core_wl_window_h mTcoreWlWindow; ///< tizen-core native window handle
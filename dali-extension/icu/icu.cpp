@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 
 #include <unicode/brkiter.h>
 #include <unicode/unistr.h>
+#include <unicode/utf16.h>
 #include <unicode/ustream.h>
 
 // INTERNAL INCLUDES
@@ -47,9 +48,41 @@ namespace Plugin
 {
 namespace
 {
+/**
+ * @brief Sets the break opportunities found by the iterator. The mandatory breaks are kept.
+ *
+ * @param[in] lineIterator The line break iterator. Its text must be set.
+ * @param[in] unicodeText The text of the iterator.
+ * @param[in,out] breakInfo The line break info to update.
+ */
+void SetLineBreaks(icu::BreakIterator& lineIterator, const icu::UnicodeString& unicodeText, TextAbstraction::LineBreakInfo* breakInfo)
+{
+  const UChar*  buffer = unicodeText.getBuffer();
+  const int32_t length = unicodeText.length();
+
+  // The break points are UTF-16 offsets, so they are mapped to characters by walking the surrogate pairs.
+  int32_t                 offset         = 0;
+  TextAbstraction::Length characterCount = 0u;
+  for(int32_t pos = lineIterator.first(); pos != icu::BreakIterator::DONE; pos = lineIterator.next())
+  {
+    while(offset < pos)
+    {
+      U16_FWD_1(buffer, offset, length);
+      ++characterCount;
+    }
+
+    if(characterCount != 0u && breakInfo[characterCount - 1u] != TextAbstraction::LINE_MUST_BREAK)
+    {
+      breakInfo[characterCount - 1u] = TextAbstraction::LINE_ALLOW_BREAK;
+    }
+  }
+}
+
 } // unnamed namespace
 
 ICU::ICU()
+: mLineBreakIterators(),
+  mMutex()
 {
 }
 
@@ -62,33 +95,60 @@ void ICU::UpdateLineBreakInfoByLocale(const std::string&              text,
                                       const char*                     locale,
                                       TextAbstraction::LineBreakInfo* breakInfo)
 {
-  icu::UnicodeString unicodeText = icu::UnicodeString::fromUTF8(text);
-  if(static_cast<uint32_t>(unicodeText.length()) != numberOfCharacters)
+  icu::UnicodeString unicodeText;
+  if(!ConvertText(text, numberOfCharacters, unicodeText))
   {
-    DALI_LOG_ERROR("UnicodeString len : %lu, numberOfCharacters : %lu\n", static_cast<uint32_t>(unicodeText.length()), numberOfCharacters);
     return;
   }
 
+  Dali::Mutex::ScopedLock lock(mMutex);
+
+  icu::BreakIterator* lineIterator = GetLineBreakIterator(locale);
+  if(lineIterator == nullptr)
+  {
+    return;
+  }
+
+  lineIterator->setText(unicodeText);
+  SetLineBreaks(*lineIterator, unicodeText, breakInfo);
+}
+
+icu::BreakIterator* ICU::GetLineBreakIterator(const char* locale)
+{
+  const std::string key(locale != nullptr ? locale : "");
+
+  auto iter = mLineBreakIterators.find(key);
+  if(iter != mLineBreakIterators.end())
+  {
+    return iter->second.get();
+  }
+
   icu::Locale icuLocale(locale);
 
   UErrorCode                          status = U_ZERO_ERROR;
   std::unique_ptr<icu::BreakIterator> lineIterator(icu::BreakIterator::createLineInstance(icuLocale, status));
 
-  if(U_FAILURE(status))
+  if(U_FAILURE(status) || !lineIterator)
   {
     DALI_LOG_ERROR("Failed to create BreakIterator: %s\n", u_errorName(status));
-    return;
+    return nullptr;
   }
 
-  lineIterator->setText(unicodeText);
+  return mLineBreakIterators.emplace(key, std::move(lineIterator)).first->second.get();
+}
 
-  for(int32_t pos = lineIterator->first(); pos != icu::BreakIterator::DONE; pos = lineIterator->next())
+bool ICU::ConvertText(const std::string& text, TextAbstraction::Length numberOfCharacters, icu::UnicodeString& unicodeText)
+{
+  unicodeText = icu::UnicodeString::fromUTF8(text);
+
+  // Characters out of the BMP take two UTF-16 units, so the code points are counted.
+  const uint32_t unicodeCharacters = static_cast<uint32_t>(unicodeText.countChar32());
+  if(unicodeCharacters != numberOfCharacters)
   {
-    if(pos != 0 && breakInfo[pos - 1] != TextAbstraction::LINE_MUST_BREAK)
-    {
-      breakInfo[pos - 1] = TextAbstraction::LINE_ALLOW_BREAK;
-    }
+    DALI_LOG_ERROR("UnicodeString characters : %u, numberOfCharacters : %u\n", unicodeCharacters, numberOfCharacters);
+    return false;
   }
+  return true;
 }
 
 } // namespace Plugin
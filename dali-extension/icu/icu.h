@@ -2,7 +2,7 @@
 #define DALI_ICU_PLUGIN_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,12 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/text-abstraction/icu-plugin.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <unicode/brkiter.h>
+#include <unicode/unistr.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace Dali
 {
@@ -49,6 +55,30 @@ public:
                                    TextAbstraction::Length         numberOfCharacters,
                                    const char*                     locale,
                                    TextAbstraction::LineBreakInfo* breakInfo) override;
+
+private:
+  /**
+   * @brief Retrieves the line break iterator of the locale, creating it the first time.
+   *
+   * @note Must be called under mMutex.
+   * @param[in] locale The locale.
+   * @return The cached iterator or nullptr if it couldn't be created.
+   */
+  icu::BreakIterator* GetLineBreakIterator(const char* locale);
+
+  /**
+   * @brief Converts the text and checks the number of characters.
+   *
+   * @param[in] text The text, encoded in UTF-8.
+   * @param[in] numberOfCharacters The expected number of characters.
+   * @param[out] unicodeText The converted text.
+   * @return Whether the number of characters matches.
+   */
+  bool ConvertText(const std::string& text, TextAbstraction::Length numberOfCharacters, icu::UnicodeString& unicodeText);
+
+private:
+  std::unordered_map<std::string, std::unique_ptr<icu::BreakIterator>> mLineBreakIterators; ///< Line break iterators per locale. Must be locked under mMutex.
+  Dali::Mutex                                                          mMutex;              ///< Protects the cached iterators, which hold the state of the current iteration.
 };
 
 } // namespace Plugin
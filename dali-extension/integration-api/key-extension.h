@@ -2,7 +2,7 @@
 #define __DALI_KEY_EXTENSION_H__
 
 /*
- * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -44,6 +44,16 @@ enum EXTENSION_KEY
  */
 DALI_IMPORT_API bool IsExtensionKey(const Dali::KeyEvent& keyEvent, Dali::EXTENSION_KEY daliKey);
 
+/**
+ * @brief Retrieves the extension DALI KEY of a key event.
+ *
+ * When a key event is checked against several extension keys, resolve it once
+ * and compare the returned code instead of calling IsExtensionKey() for each key.
+ * @param keyEvent reference to a keyEvent structure
+ * @return The extension key code, or DALI_KEY_INVALID if the key is not an extension key
+ */
+DALI_IMPORT_API int GetExtensionKeyCode(const Dali::KeyEvent& keyEvent);
+
 namespace Plugin
 {
 class KeyExtension : public Dali::KeyExtensionPlugin
@@ -0,0 +1,241 @@
+#ifndef DALI_EXTENSION_INTEGRATION_API_MEDIA_FRAME_QUEUE_H
+#define DALI_EXTENSION_INTEGRATION_API_MEDIA_FRAME_QUEUE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/public-api/object/any.h>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+namespace Dali
+{
+namespace Plugin
+{
+/**
+ * @brief Delivers the decoded frames of a media player or a camera to the event thread.
+ *
+ * A producer thread pushes packets, and the event thread presents them one update at a time.
+ * A presented packet is retained for a few more updates, because the compositor may still read
+ * its surface. Packets are destroyed outside the lock, so the producer is never blocked by it.
+ */
+class MediaFrameQueue
+{
+public:
+  /**
+   * @brief How the pending packets are handled when Present() is called.
+   */
+  enum class DropPolicy
+  {
+    NONE,       ///< Presents the oldest pending packet. Every packet is shown.
+    KEEP_LATEST ///< Presents the newest pending packet and drops the older ones.
+  };
+
+  /**
+   * @brief The number of packets handled since the queue is created.
+   */
+  struct Statistics
+  {
+    uint32_t pushed{0u};    ///< Packets pushed by the producer
+    uint32_t presented{0u}; ///< Packets presented on the event thread
+    uint32_t dropped{0u};   ///< Packets destroyed without being presented
+  };
+
+  using DestroyFunction = std::function<void(void* packet)>;
+  using SurfaceFunction = std::function<Any(void* packet)>;
+
+  static constexpr size_t DEFAULT_RETAIN_COUNT = 3u;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] destroy Destroys a packet.
+   * @param[in] getSurface Extracts the surface of a packet. It returns an empty Any on failure.
+   * @param[in] dropPolicy How the pending packets are presented.
+   * @param[in] retainCount The number of presented packets kept alive. At least the presented one is kept.
+   */
+  MediaFrameQueue(DestroyFunction destroy, SurfaceFunction getSurface, DropPolicy dropPolicy = DropPolicy::NONE, size_t retainCount = DEFAULT_RETAIN_COUNT)
+  : mMutex(),
+    mDestroy(std::move(destroy)),
+    mGetSurface(std::move(getSurface)),
+    mPendingPackets(),
+    mRetainedPackets(),
+    mStatistics(),
+    mDropPolicy(dropPolicy),
+    mRetainCount(retainCount > 0u ? retainCount : 1u)
+  {
+  }
+
+  /**
+   * @brief Destructor. The remaining packets are destroyed.
+   */
+  ~MediaFrameQueue()
+  {
+    Clear();
+  }
+
+  MediaFrameQueue(const MediaFrameQueue&) = delete;
+  MediaFrameQueue& operator=(const MediaFrameQueue&) = delete;
+
+  /**
+   * @brief Pushes a decoded packet. It can be called in any thread.
+   *
+   * @param[in] packet The packet. The queue owns it.
+   * @return True if the queue was empty, i.e. the event thread should be woken up.
+   */
+  bool Push(void* packet)
+  {
+    if(!packet)
+    {
+      return false;
+    }
+
+    Dali::Mutex::ScopedLock lock(mMutex);
+    const bool wasEmpty = mPendingPackets.empty();
+    mPendingPackets.push_back(packet);
+    ++mStatistics.pushed;
+    return wasEmpty;
+  }
+
+  /**
+   * @brief Takes the packet to present by the drop policy, and retains it. This function is called in the event thread.
+   *
+   * @return The surface of the presented packet, or an empty Any if there is nothing to present.
+   */
+  Any Present()
+  {
+    std::vector<void*> garbage;
+    Any                surface;
+    {
+      Dali::Mutex::ScopedLock lock(mMutex);
+
+      while(!mPendingPackets.empty() && surface.Empty())
+      {
+        void* packet;
+        if(mDropPolicy == DropPolicy::KEEP_LATEST)
+        {
+          packet = mPendingPackets.back();
+          mPendingPackets.pop_back();
+          mStatistics.dropped += static_cast<uint32_t>(mPendingPackets.size());
+          garbage.insert(garbage.end(), mPendingPackets.begin(), mPendingPackets.end());
+          mPendingPackets.clear();
+        }
+        else
+        {
+          packet = mPendingPackets.front();
+          mPendingPackets.pop_front();
+        }
+
+        surface = mGetSurface ? mGetSurface(packet) : Any();
+        if(surface.Empty())
+        {
+          // Failed to extract the surface. Try the next one.
+          ++mStatistics.dropped;
+          garbage.push_back(packet);
+          continue;
+        }
+
+        ++mStatistics.presented;
+        mRetainedPackets.push_back(packet);
+        while(mRetainedPackets.size() > mRetainCount)
+        {
+          garbage.push_back(mRetainedPackets.front());
+          mRetainedPackets.pop_front();
+        }
+      }
+    }
+
+    DestroyPackets(garbage);
+    return surface;
+  }
+
+  /**
+   * @brief Retrieves whether any packet is waiting to be presented.
+   */
+  bool HasPendingPackets() const
+  {
+    Dali::Mutex::ScopedLock lock(mMutex);
+    return !mPendingPackets.empty();
+  }
+
+  /**
+   * @brief Destroys all the pending and the retained packets.
+   */
+  void Clear()
+  {
+    std::vector<void*> garbage;
+    {
+      Dali::Mutex::ScopedLock lock(mMutex);
+      mStatistics.dropped += static_cast<uint32_t>(mPendingPackets.size());
+      garbage.insert(garbage.end(), mPendingPackets.begin(), mPendingPackets.end());
+      garbage.insert(garbage.end(), mRetainedPackets.begin(), mRetainedPackets.end());
+      mPendingPackets.clear();
+      mRetainedPackets.clear();
+    }
+
+    DestroyPackets(garbage);
+  }
+
+  /**
+   * @brief Sets the drop policy.
+   */
+  void SetDropPolicy(DropPolicy dropPolicy)
+  {
+    Dali::Mutex::ScopedLock lock(mMutex);
+    mDropPolicy = dropPolicy;
+  }
+
+  /**
+   * @brief Retrieves the statistics.
+   */
+  Statistics GetStatistics() const
+  {
+    Dali::Mutex::ScopedLock lock(mMutex);
+    return mStatistics;
+  }
+
+private:
+  void DestroyPackets(const std::vector<void*>& packets)
+  {
+    if(mDestroy)
+    {
+      for(void* packet : packets)
+      {
+        mDestroy(packet);
+      }
+    }
+  }
+
+private:
+  mutable Dali::Mutex mMutex;
+  DestroyFunction     mDestroy;
+  SurfaceFunction     mGetSurface;
+  std::deque<void*>   mPendingPackets;  ///< Packets waiting to be presented
+  std::deque<void*>   mRetainedPackets; ///< Recently presented packets, kept alive to prevent tearing
+  Statistics          mStatistics;
+  DropPolicy          mDropPolicy;
+  size_t              mRetainCount;
+};
+
+} // namespace Plugin
+} // namespace Dali
+
+#endif // DALI_EXTENSION_INTEGRATION_API_MEDIA_FRAME_QUEUE_H
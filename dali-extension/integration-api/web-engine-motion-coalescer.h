@@ -0,0 +1,158 @@
+#ifndef DALI_EXTENSION_INTEGRATION_API_WEB_ENGINE_MOTION_COALESCER_H
+#define DALI_EXTENSION_INTEGRATION_API_WEB_ENGINE_MOTION_COALESCER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/integration-api/processor-interface.h>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+namespace Dali
+{
+namespace Plugin
+{
+/**
+ * @brief Coalesces the pointer motion sent to a web engine into one dispatch per frame.
+ *
+ * Motion samples are stored instead of being dispatched. The latest one is dispatched
+ * by a processor which runs before the next update, so the engine renders with the
+ * latest position without handling every intermediate sample.
+ * Other events must call Flush() before they are dispatched to keep the event order.
+ */
+class WebEngineMotionCoalescer : public Integration::Processor
+{
+public:
+  /**
+   * @brief A motion sample.
+   */
+  struct Sample
+  {
+    float    x;      ///< The x position
+    float    y;      ///< The y position
+    uint32_t time;   ///< The time of the event in milliseconds
+    uint32_t source; ///< The kind of motion, defined by the owner. Samples of a different source are never merged.
+  };
+
+  using DispatchCallback = std::function<void(const Sample& sample)>;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] dispatch Called on the event thread with the sample to dispatch.
+   */
+  explicit WebEngineMotionCoalescer(DispatchCallback dispatch)
+  : mDispatch(std::move(dispatch)),
+    mPendingSample(),
+    mHasPendingSample(false),
+    mProcessorRegistered(false)
+  {
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  ~WebEngineMotionCoalescer() override
+  {
+    if(mProcessorRegistered && Dali::Adaptor::IsAvailable())
+    {
+      Dali::Adaptor::Get().UnregisterProcessorOnce(*this);
+    }
+  }
+
+  WebEngineMotionCoalescer(const WebEngineMotionCoalescer&) = delete;
+  WebEngineMotionCoalescer& operator=(const WebEngineMotionCoalescer&) = delete;
+
+  /**
+   * @brief Stores a motion sample, replacing the pending one of the same source.
+   */
+  void AddMotion(float x, float y, uint32_t time, uint32_t source = 0u)
+  {
+    if(mHasPendingSample && mPendingSample.source != source)
+    {
+      Flush();
+    }
+
+    mPendingSample    = Sample{x, y, time, source};
+    mHasPendingSample = true;
+
+    if(!mProcessorRegistered && Dali::Adaptor::IsAvailable())
+    {
+      mProcessorRegistered = true;
+      Dali::Adaptor::Get().RegisterProcessorOnce(*this);
+    }
+    else if(!mProcessorRegistered)
+    {
+      Flush();
+    }
+  }
+
+  /**
+   * @brief Dispatches the pending sample, if any.
+   */
+  void Flush()
+  {
+    if(mHasPendingSample)
+    {
+      mHasPendingSample = false;
+      if(mDispatch)
+      {
+        mDispatch(mPendingSample);
+      }
+    }
+  }
+
+  /**
+   * @brief Discards the pending sample.
+   */
+  void Clear()
+  {
+    mHasPendingSample = false;
+  }
+
+protected: // Implementation of Processor
+  /**
+   * @copydoc Dali::Integration::Processor::Process()
+   */
+  void Process(bool postProcessor) override
+  {
+    mProcessorRegistered = false;
+    Flush();
+  }
+
+  /**
+   * @copydoc Dali::Integration::Processor::GetProcessorName()
+   */
+  std::string_view GetProcessorName() const override
+  {
+    return "WebEngineMotionCoalescer";
+  }
+
+private:
+  DispatchCallback mDispatch;
+  Sample           mPendingSample;
+  bool             mHasPendingSample;
+  bool             mProcessorRegistered;
+};
+
+} // namespace Plugin
+} // namespace Dali
+
+#endif // DALI_EXTENSION_INTEGRATION_API_WEB_ENGINE_MOTION_COALESCER_H
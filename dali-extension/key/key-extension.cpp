@@ -18,6 +18,10 @@
 // CLASS HEADER
 #include <integration-api/key-extension.h>
 
+// EXTERNAL INCLUDES
+#include <string_view>
+#include <unordered_map>
+
 // The plugin factories
 extern "C" DALI_EXPORT_API Dali::KeyExtensionPlugin* CreateKeyExtensionPlugin(void)
 {
@@ -40,20 +44,56 @@ KeyExtensionPlugin::KeyLookup mKeyLookupTable[] =
     // more than one key name can be assigned to a single key code
 };
 
-bool IsExtensionKey(const Dali::KeyEvent& keyEvent, Dali::EXTENSION_KEY daliKey)
+namespace
 {
-  int key = -200000;
+using KeyLookupIndex = std::unordered_map<std::string_view, int>;
 
-  for(size_t i = 0; i < sizeof(mKeyLookupTable) / sizeof(KeyExtensionPlugin::KeyLookup); i++)
+/**
+ * Hashes the key names of the lookup table once, keeping the first code of a name like the table scan did.
+ */
+const KeyLookupIndex& GetKeyLookupIndex()
+{
+  static const KeyLookupIndex index = []()
   {
-    if(keyEvent.GetKeyName() == mKeyLookupTable[i].keyName)
+    KeyLookupIndex lookupIndex;
+    for(size_t i = 0; i < sizeof(mKeyLookupTable) / sizeof(KeyExtensionPlugin::KeyLookup); i++)
     {
-      key = mKeyLookupTable[i].daliKeyCode;
-      break;
+      lookupIndex.emplace(mKeyLookupTable[i].keyName, mKeyLookupTable[i].daliKeyCode);
     }
+    return lookupIndex;
+  }();
+  return index;
+}
+
+bool FindExtensionKeyCode(const Dali::KeyEvent& keyEvent, int& daliKeyCode)
+{
+  const KeyLookupIndex& index = GetKeyLookupIndex();
+  if(index.empty())
+  {
+    return false;
+  }
+
+  const auto iter = index.find(keyEvent.GetKeyName());
+  if(iter == index.end())
+  {
+    return false;
   }
 
-  return daliKey == key;
+  daliKeyCode = iter->second;
+  return true;
+}
+} // unnamed namespace
+
+bool IsExtensionKey(const Dali::KeyEvent& keyEvent, Dali::EXTENSION_KEY daliKey)
+{
+  int key = 0;
+  return FindExtensionKeyCode(keyEvent, key) && daliKey == key;
+}
+
+int GetExtensionKeyCode(const Dali::KeyEvent& keyEvent)
+{
+  int key = 0;
+  return FindExtensionKeyCode(keyEvent, key) ? key : static_cast<int>(DALI_KEY_INVALID);
 }
 
 namespace Plugin
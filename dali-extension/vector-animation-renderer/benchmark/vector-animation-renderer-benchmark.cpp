@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * Measures VectorAnimationRendererX on a corpus of Lottie files.
+ *
+ * Usage: vector-animation-renderer-benchmark [--sizes=64,256,512] [--frames=60] file...
+ *
+ * For every file, one JSON object is written to stdout on its own line with the load time,
+ * the Render latency and the OnNotify upload cost for each size, and the peak RSS so far.
+ * The renderer needs DALi's event thread, so this runs as a DALi application and needs a display.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/application.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-extension/benchmark/benchmark-utils.h>
+#include <dali-extension/vector-animation-renderer/vector-animation-renderer-x.h>
+
+namespace
+{
+using namespace Dali::Benchmark;
+
+struct Options
+{
+  std::vector<uint32_t>    sizes{64u, 256u, 512u};
+  uint32_t                 frameCount{60u};
+  std::vector<std::string> files;
+};
+
+long GetPeakRssKb()
+{
+  struct rusage usage;
+  return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : -1;
+}
+
+std::string EscapeJson(const std::string& text)
+{
+  std::string escaped;
+  for(char character : text)
+  {
+    if(character == '"' || character == '\\')
+    {
+      escaped += '\\';
+    }
+    escaped += character;
+  }
+  return escaped;
+}
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+  for(int i = 1; i < argc; ++i)
+  {
+    const char* argument = argv[i];
+    if(const char* sizes = GetOptionValue(argument, "--sizes"))
+    {
+      if(!ParseUnsignedList(sizes, options.sizes))
+      {
+        return false;
+      }
+    }
+    else if(const char* frames = GetOptionValue(argument, "--frames"))
+    {
+      if(!ParseUnsigned(frames, options.frameCount))
+      {
+        return false;
+      }
+    }
+    else if(std::strncmp(argument, "--", 2) == 0)
+    {
+      return false;
+    }
+    else
+    {
+      options.files.push_back(argument);
+    }
+  }
+  return !options.files.empty() && !options.sizes.empty();
+}
+
+class Benchmark : public Dali::ConnectionTracker
+{
+public:
+  Benchmark(Dali::Application& application, Options options)
+  : mOptions(std::move(options)),
+    mFailed(false)
+  {
+    application.InitSignal().Connect(this, &Benchmark::OnInit);
+  }
+
+  bool IsFailed() const
+  {
+    return mFailed;
+  }
+
+private:
+  void OnInit(Dali::Application& application)
+  {
+    for(const auto& file : mOptions.files)
+    {
+      if(!Run(file))
+      {
+        mFailed = true;
+      }
+    }
+    application.Quit();
+  }
+
+  bool Run(const std::string& file)
+  {
+    double      loadTime    = 0.0;
+    uint32_t    totalFrames = 0u;
+    std::string results;
+    for(uint32_t size : mOptions.sizes)
+    {
+      // A resized renderer prepares its new target in a worker, which completes only after OnInit returns.
+      // So each size gets its own renderer, whose first target is prepared in SetSize.
+      Dali::Plugin::VectorAnimationRendererX renderer;
+
+      const auto loadStart = Clock::now();
+      const bool loaded    = renderer.Load(file);
+      if(results.empty())
+      {
+        // rlottie caches the parsed model by the path, so only the first load is measured.
+        loadTime = ElapsedMilliseconds(loadStart);
+      }
+      if(!loaded || renderer.GetTotalFrameNumber() == 0u)
+      {
+        std::printf("{\"file\":\"%s\",\"error\":\"load failed\"}\n", EscapeJson(file).c_str());
+        renderer.Finalize();
+        return false;
+      }
+
+      totalFrames               = renderer.GetTotalFrameNumber();
+      const uint32_t frameCount = std::min(mOptions.frameCount, totalFrames);
+
+      renderer.SetSize(size, size);
+
+      // The first Render moves the prepared target to the current one, so it is not measured.
+      renderer.Render(0u);
+      static_cast<Dali::Plugin::VectorAnimationEventHandler&>(renderer).NotifyEvent();
+
+      std::vector<double> renderTimes;
+      std::vector<double> notifyTimes;
+      for(uint32_t i = 0u; i < frameCount; ++i)
+      {
+        const uint32_t frameNumber = static_cast<uint32_t>(static_cast<uint64_t>(i) * totalFrames / frameCount);
+
+        const auto renderStart = Clock::now();
+        renderer.Render(frameNumber);
+        renderTimes.push_back(ElapsedMilliseconds(renderStart));
+
+        const auto notifyStart = Clock::now();
+        static_cast<Dali::Plugin::VectorAnimationEventHandler&>(renderer).NotifyEvent();
+        notifyTimes.push_back(ElapsedMilliseconds(notifyStart));
+      }
+
+      renderer.Finalize();
+
+      const Statistics render = GetStatistics(renderTimes);
+      const Statistics notify = GetStatistics(notifyTimes);
+
+      char result[512];
+      std::snprintf(result,
+                    sizeof(result),
+                    "%s{\"size\":%u,\"frames\":%u,\"renderMeanMs\":%.4f,\"renderMedianMs\":%.4f,\"renderP95Ms\":%.4f,\"renderMaxMs\":%.4f,"
+                    "\"notifyMeanMs\":%.4f,\"notifyMedianMs\":%.4f,\"notifyP95Ms\":%.4f,\"notifyMaxMs\":%.4f}",
+                    results.empty() ? "" : ",",
+                    size,
+                    frameCount,
+                    render.mean,
+                    render.median,
+                    render.p95,
+                    render.max,
+                    notify.mean,
+                    notify.median,
+                    notify.p95,
+                    notify.max);
+      results += result;
+    }
+
+    std::printf("{\"file\":\"%s\",\"loadMs\":%.4f,\"totalFrames\":%u,\"results\":[%s],\"peakRssKb\":%ld}\n",
+                EscapeJson(file).c_str(),
+                loadTime,
+                totalFrames,
+                results.c_str(),
+                GetPeakRssKb());
+    std::fflush(stdout);
+    return true;
+  }
+
+private:
+  Options mOptions;
+  bool    mFailed;
+};
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+  Options options;
+  if(!ParseOptions(argc, argv, options))
+  {
+    std::fprintf(stderr, "Usage: %s [--sizes=64,256,512] [--frames=60] file...\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  Dali::Application application = Dali::Application::New(&argc, &argv);
+  Benchmark         benchmark(application, std::move(options));
+  application.MainLoop();
+  return benchmark.IsFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
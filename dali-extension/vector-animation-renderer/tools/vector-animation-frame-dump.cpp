@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * Writes the frames of Lottie files as PNG or raw BGRA8888 sequences, with VectorAnimationHeadlessRenderer.
+ *
+ * Usage: vector-animation-frame-dump [--size=WxH] [--range=START-END] [--format=png|raw] [--threads=N] [--output=DIR] file...
+ *
+ * The frames of "DIR/name.json" are written to "DIR/name-00000.png" and so on. By default, all the frames
+ * are written at the default size of the file, into the directory of the file. No display is needed.
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-extension/vector-animation-renderer/vector-animation-headless-renderer.h>
+
+namespace
+{
+using Dali::Plugin::VectorAnimationHeadlessRenderer;
+
+struct Options
+{
+  uint32_t                                    width{0u}; ///< 0 to use the default size of the file
+  uint32_t                                    height{0u};
+  uint32_t                                    startFrame{0u};
+  uint32_t                                    endFrame{0u};
+  bool                                        hasRange{false};
+  uint32_t                                    threadCount{0u};
+  VectorAnimationHeadlessRenderer::FileFormat format{VectorAnimationHeadlessRenderer::FileFormat::PNG};
+  std::string                                 outputDir;
+  std::vector<std::string>                    files;
+};
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+  for(int i = 1; i < argc; ++i)
+  {
+    const char* argument = argv[i];
+    char        end;
+    if(std::strncmp(argument, "--size=", 7) == 0)
+    {
+      if(std::sscanf(argument + 7, "%ux%u%c", &options.width, &options.height, &end) != 2 || options.width == 0u || options.height == 0u)
+      {
+        return false;
+      }
+    }
+    else if(std::strncmp(argument, "--range=", 8) == 0)
+    {
+      if(std::sscanf(argument + 8, "%u-%u%c", &options.startFrame, &options.endFrame, &end) != 2 || options.startFrame > options.endFrame)
+      {
+        return false;
+      }
+      options.hasRange = true;
+    }
+    else if(std::strcmp(argument, "--format=png") == 0)
+    {
+      options.format = VectorAnimationHeadlessRenderer::FileFormat::PNG;
+    }
+    else if(std::strcmp(argument, "--format=raw") == 0)
+    {
+      options.format = VectorAnimationHeadlessRenderer::FileFormat::RAW;
+    }
+    else if(std::strncmp(argument, "--threads=", 10) == 0)
+    {
+      if(std::sscanf(argument + 10, "%u%c", &options.threadCount, &end) != 1)
+      {
+        return false;
+      }
+    }
+    else if(std::strncmp(argument, "--output=", 9) == 0)
+    {
+      options.outputDir = argument + 9;
+    }
+    else if(std::strncmp(argument, "--", 2) == 0)
+    {
+      return false;
+    }
+    else
+    {
+      options.files.push_back(argument);
+    }
+  }
+  return !options.files.empty();
+}
+
+/**
+ * @brief Gets the path prefix of the frames of the file, e.g. "out/name-" for "in/name.json".
+ */
+std::string GetPathPrefix(const std::string& file, const std::string& outputDir)
+{
+  const size_t separator = file.find_last_of('/');
+  std::string  name      = (separator == std::string::npos) ? file : file.substr(separator + 1u);
+  const size_t extension = name.find_last_of('.');
+  if(extension != std::string::npos && extension != 0u)
+  {
+    name.resize(extension);
+  }
+
+  std::string directory = outputDir.empty() ? ((separator == std::string::npos) ? std::string() : file.substr(0u, separator + 1u)) : outputDir;
+  if(!directory.empty() && directory.back() != '/')
+  {
+    directory += '/';
+  }
+  return directory + name + "-";
+}
+
+bool Dump(const std::string& file, const Options& options)
+{
+  VectorAnimationHeadlessRenderer renderer;
+  renderer.SetThreadCount(options.threadCount);
+  if(!renderer.Load(file) || renderer.GetTotalFrameNumber() == 0u)
+  {
+    std::fprintf(stderr, "%s: failed to load\n", file.c_str());
+    return false;
+  }
+
+  uint32_t width  = options.width;
+  uint32_t height = options.height;
+  if(width == 0u)
+  {
+    renderer.GetDefaultSize(width, height);
+  }
+
+  const uint32_t    startFrame = options.hasRange ? options.startFrame : 0u;
+  const uint32_t    endFrame   = options.hasRange ? options.endFrame : renderer.GetTotalFrameNumber() - 1u;
+  const std::string prefix     = GetPathPrefix(file, options.outputDir);
+  if(!renderer.DumpFrames(startFrame, endFrame, width, height, prefix, options.format))
+  {
+    std::fprintf(stderr, "%s: failed to write frames %u-%u of %u at %ux%u to %s\n", file.c_str(), startFrame, endFrame, renderer.GetTotalFrameNumber(), width, height, prefix.c_str());
+    return false;
+  }
+
+  std::printf("%s: wrote frames %u-%u at %ux%u to %s\n", file.c_str(), startFrame, endFrame, width, height, prefix.c_str());
+  return true;
+}
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+  Options options;
+  if(!ParseOptions(argc, argv, options))
+  {
+    std::fprintf(stderr, "Usage: %s [--size=WxH] [--range=START-END] [--format=png|raw] [--threads=N] [--output=DIR] file...\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  bool failed = false;
+  for(const auto& file : options.files)
+  {
+    if(!Dump(file, options))
+    {
+      failed = true;
+    }
+  }
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-extension/vector-animation-renderer/vector-animation-atlas-manager.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/math/math-utils.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace Dali
+{
+namespace Plugin
+{
+namespace
+{
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_VECTOR_ANIMATION");
+#endif
+
+constexpr uint32_t ATLAS_SIZE            = 512u;
+constexpr uint32_t MAX_ATLAS_REGION_SIZE = ATLAS_SIZE / 2u;
+constexpr uint32_t SLOT_SIZE_STEP        = 8u;  ///< Slot sizes are rounded up, so a released slot fits animations of similar sizes.
+constexpr uint32_t REGION_PADDING        = 1u;  ///< A transparent gap, so linear filtering does not sample the neighbours.
+constexpr uint32_t BYTES_PER_PIXEL       = 4u;
+constexpr auto     ATLAS_MAX_SIZE_ENV    = "DALI_VECTOR_ANIMATION_ATLAS_MAX_SIZE";
+
+uint32_t GetMaxRegionSize()
+{
+  const char* sizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(ATLAS_MAX_SIZE_ENV);
+  const auto  size       = sizeString ? std::strtoul(sizeString, nullptr, 10) : 0u;
+  return static_cast<uint32_t>(std::min<unsigned long>(size, MAX_ATLAS_REGION_SIZE));
+}
+
+uint32_t GetSlotSize(uint32_t size)
+{
+  return (size + REGION_PADDING + SLOT_SIZE_STEP - 1u) / SLOT_SIZE_STEP * SLOT_SIZE_STEP;
+}
+
+} // unnamed namespace
+
+struct VectorAnimationAtlasManager::Atlas
+{
+  struct Shelf
+  {
+    uint32_t                                   y;
+    uint32_t                                   height;
+    uint32_t                                   usedWidth;
+    std::vector<std::pair<uint32_t, uint32_t>> freeSlots; ///< first : x offset, second : width of a released slot
+  };
+
+  /**
+   * @brief Finds a free slot. The slot sizes are rounded, so a released slot is reused only by the same rounded size.
+   */
+  bool Allocate(uint32_t slotWidth, uint32_t slotHeight, uint32_t& x, uint32_t& y)
+  {
+    for(auto& shelf : shelves)
+    {
+      if(shelf.height != slotHeight)
+      {
+        continue;
+      }
+
+      auto freeSlot = std::find_if(shelf.freeSlots.begin(), shelf.freeSlots.end(), [slotWidth](const std::pair<uint32_t, uint32_t>& slot) { return slot.second == slotWidth; });
+      if(freeSlot != shelf.freeSlots.end())
+      {
+        x = freeSlot->first;
+        y = shelf.y;
+        shelf.freeSlots.erase(freeSlot);
+        return true;
+      }
+
+      if(shelf.usedWidth + slotWidth <= ATLAS_SIZE)
+      {
+        x = shelf.usedWidth;
+        y = shelf.y;
+        shelf.usedWidth += slotWidth;
+        return true;
+      }
+    }
+
+    if(usedHeight + slotHeight > ATLAS_SIZE)
+    {
+      return false;
+    }
+
+    shelves.push_back(Shelf{usedHeight, slotHeight, slotWidth, {}});
+    x = 0u;
+    y = usedHeight;
+    usedHeight += slotHeight;
+    return true;
+  }
+
+  void Free(uint32_t slotWidth, uint32_t x, uint32_t y)
+  {
+    for(auto& shelf : shelves)
+    {
+      if(shelf.y == y)
+      {
+        shelf.freeSlots.emplace_back(x, slotWidth);
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief Clears the pixels of a slot, including its padding, so the next region in it starts from a transparent slot.
+   */
+  void ClearSlot(uint32_t x, uint32_t y, uint32_t slotWidth, uint32_t slotHeight)
+  {
+    const uint32_t width  = std::min(slotWidth, ATLAS_SIZE - x);
+    const uint32_t height = std::min(slotHeight, ATLAS_SIZE - y);
+    const size_t   stride = static_cast<size_t>(pixelBuffer.GetStrideBytes());
+    uint8_t*       buffer = pixelBuffer.GetBuffer() + y * stride + x * BYTES_PER_PIXEL;
+    for(uint32_t row = 0u; row < height; ++row)
+    {
+      memset(buffer + row * stride, 0, static_cast<size_t>(width) * BYTES_PER_PIXEL);
+    }
+
+    dirtyTop    = std::min(dirtyTop, y);
+    dirtyBottom = std::max(dirtyBottom, y + height);
+  }
+
+  uint32_t                 id{0u};
+  float                    frameRate{0.0f};
+  Dali::Texture            texture;
+  Dali::Devel::PixelBuffer pixelBuffer;
+  std::vector<Shelf>       shelves;
+  uint32_t                 usedHeight{0u};
+  uint32_t                 regionCount{0u};
+  uint32_t                 dirtyTop{ATLAS_SIZE};
+  uint32_t                 dirtyBottom{0u};
+};
+
+VectorAnimationAtlasManager& VectorAnimationAtlasManager::Get()
+{
+  static VectorAnimationAtlasManager atlasManager;
+  return atlasManager;
+}
+
+VectorAnimationAtlasManager::VectorAnimationAtlasManager()
+: mAtlases(),
+  mMutex(),
+  mMaxRegionSize(GetMaxRegionSize()),
+  mNextAtlasId(1u)
+{
+}
+
+VectorAnimationAtlasManager::~VectorAnimationAtlasManager()
+{
+}
+
+bool VectorAnimationAtlasManager::IsAtlasable(uint32_t width, uint32_t height) const
+{
+  return width > 0u && height > 0u && width <= mMaxRegionSize && height <= mMaxRegionSize;
+}
+
+// This function is called in the main thread.
+bool VectorAnimationAtlasManager::Allocate(float frameRate, uint32_t width, uint32_t height, Region& region)
+{
+  if(!IsAtlasable(width, height))
+  {
+    return false;
+  }
+
+  const uint32_t slotWidth  = GetSlotSize(width);
+  const uint32_t slotHeight = GetSlotSize(height);
+
+  Dali::Mutex::ScopedLock lock(mMutex);
+
+  Atlas*   atlas = nullptr;
+  uint32_t x = 0u, y = 0u;
+  for(auto& candidate : mAtlases)
+  {
+    if(Dali::Equals(candidate->frameRate, frameRate) && candidate->Allocate(slotWidth, slotHeight, x, y))
+    {
+      atlas = candidate.get();
+      break;
+    }
+  }
+
+  if(!atlas)
+  {
+    auto newAtlas         = std::make_unique<Atlas>();
+    newAtlas->id          = mNextAtlasId++;
+    newAtlas->frameRate   = frameRate;
+    newAtlas->texture     = Texture::New(Dali::TextureType::TEXTURE_2D, Dali::Pixel::BGRA8888, ATLAS_SIZE, ATLAS_SIZE);
+    newAtlas->pixelBuffer = Dali::Devel::PixelBuffer::New(ATLAS_SIZE, ATLAS_SIZE, Dali::Pixel::BGRA8888);
+    memset(newAtlas->pixelBuffer.GetBuffer(), 0, static_cast<size_t>(newAtlas->pixelBuffer.GetStrideBytes()) * ATLAS_SIZE);
+
+    // The gaps between the regions must be uploaded once.
+    newAtlas->dirtyTop    = 0u;
+    newAtlas->dirtyBottom = ATLAS_SIZE;
+
+    if(!newAtlas->Allocate(slotWidth, slotHeight, x, y))
+    {
+      return false;
+    }
+
+    DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "New atlas [id = %u, frame rate = %f]\n", newAtlas->id, frameRate);
+
+    atlas = newAtlas.get();
+    mAtlases.push_back(std::move(newAtlas));
+  }
+
+  ++atlas->regionCount;
+
+  region.texture     = atlas->texture;
+  region.atlasId     = atlas->id;
+  region.x           = x;
+  region.y           = y;
+  region.width       = width;
+  region.height      = height;
+  region.textureRect = Vector4(static_cast<float>(x) / ATLAS_SIZE, static_cast<float>(y) / ATLAS_SIZE, static_cast<float>(width) / ATLAS_SIZE, static_cast<float>(height) / ATLAS_SIZE);
+
+  return true;
+}
+
+void VectorAnimationAtlasManager::Release(const Region& region)
+{
+  Dali::Mutex::ScopedLock lock(mMutex);
+
+  if(Atlas* atlas = FindAtlas(region.atlasId))
+  {
+    // A smaller region may reuse the slot, so the old frame must not remain in its padding.
+    atlas->ClearSlot(region.x, region.y, GetSlotSize(region.width), GetSlotSize(region.height));
+    atlas->Free(GetSlotSize(region.width), region.x, region.y);
+    if(atlas->regionCount > 0u)
+    {
+      --atlas->regionCount;
+    }
+  }
+}
+
+// This function is called in the main thread.
+void VectorAnimationAtlasManager::UpdateRegion(const Region& region, Dali::Devel::PixelBuffer pixelBuffer)
+{
+  if(!pixelBuffer || pixelBuffer.GetWidth() != region.width || pixelBuffer.GetHeight() != region.height)
+  {
+    return;
+  }
+
+  Dali::Mutex::ScopedLock lock(mMutex);
+
+  Atlas* atlas = FindAtlas(region.atlasId);
+  if(!atlas)
+  {
+    return;
+  }
+
+  const size_t   rowSize      = static_cast<size_t>(region.width) * BYTES_PER_PIXEL;
+  const size_t   sourceStride = static_cast<size_t>(pixelBuffer.GetStrideBytes());
+  const size_t   atlasStride  = static_cast<size_t>(atlas->pixelBuffer.GetStrideBytes());
+  const uint8_t* source       = pixelBuffer.GetBuffer();
+  uint8_t*       destination  = atlas->pixelBuffer.GetBuffer() + region.y * atlasStride + region.x * BYTES_PER_PIXEL;
+  for(uint32_t row = 0u; row < region.height; ++row)
+  {
+    memcpy(destination + row * atlasStride, source + row * sourceStride, rowSize);
+  }
+
+  atlas->dirtyTop    = std::min(atlas->dirtyTop, region.y);
+  atlas->dirtyBottom = std::max(atlas->dirtyBottom, region.y + region.height);
+}
+
+// This function is called in the main thread.
+void VectorAnimationAtlasManager::UploadAtlases()
+{
+  Dali::Mutex::ScopedLock lock(mMutex);
+
+  // The atlases without regions are destroyed here, so the textures are released in the main thread.
+  mAtlases.erase(std::remove_if(mAtlases.begin(), mAtlases.end(), [](const std::unique_ptr<Atlas>& atlas) { return atlas->regionCount == 0u; }), mAtlases.end());
+
+  for(auto& atlas : mAtlases)
+  {
+    if(atlas->dirtyTop >= atlas->dirtyBottom)
+    {
+      continue;
+    }
+
+    // Upload the changed rows with a single call. The rows are contiguous in the atlas buffer.
+    const uint32_t bandHeight  = atlas->dirtyBottom - atlas->dirtyTop;
+    const size_t   atlasStride = static_cast<size_t>(atlas->pixelBuffer.GetStrideBytes());
+    const size_t   rowSize     = static_cast<size_t>(ATLAS_SIZE) * BYTES_PER_PIXEL;
+    const uint32_t bufferSize  = static_cast<uint32_t>(rowSize * bandHeight);
+
+    uint8_t*       buffer = new uint8_t[bufferSize];
+    const uint8_t* source = atlas->pixelBuffer.GetBuffer() + atlas->dirtyTop * atlasStride;
+    for(uint32_t row = 0u; row < bandHeight; ++row)
+    {
+      memcpy(buffer + row * rowSize, source + row * atlasStride, rowSize);
+    }
+
+    PixelData pixelData = PixelData::New(buffer, bufferSize, ATLAS_SIZE, bandHeight, Dali::Pixel::BGRA8888, PixelData::DELETE_ARRAY);
+    atlas->texture.Upload(pixelData, 0u, 0u, 0u, atlas->dirtyTop, ATLAS_SIZE, bandHeight);
+
+    atlas->dirtyTop    = ATLAS_SIZE;
+    atlas->dirtyBottom = 0u;
+  }
+}
+
+// This Method is called inside mMutex
+VectorAnimationAtlasManager::Atlas* VectorAnimationAtlasManager::FindAtlas(uint32_t atlasId)
+{
+  for(auto& atlas : mAtlases)
+  {
+    if(atlas->id == atlasId)
+    {
+      return atlas.get();
+    }
+  }
+  return nullptr;
+}
+
+} // namespace Plugin
+
+} // namespace Dali
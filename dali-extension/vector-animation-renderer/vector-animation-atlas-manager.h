@@ -0,0 +1,142 @@
+#ifndef DALI_VECTOR_ANIMATION_ATLAS_MANAGER_H
+#define DALI_VECTOR_ANIMATION_ATLAS_MANAGER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/devel-api/common/vector-wrapper.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/rendering/texture.h>
+#include <memory>
+
+namespace Dali
+{
+namespace Plugin
+{
+/**
+ * @brief Packs small vector animations into regions of shared textures.
+ *
+ * Animations with the same frame rate share an atlas, so their frames are usually ready in the same event.
+ * A renderer copies its frame into its region with UpdateRegion(), and all the changed rows of an atlas
+ * are uploaded once by UploadAtlases() after the events are processed.
+ *
+ * Atlasing is enabled by DALI_VECTOR_ANIMATION_ATLAS_MAX_SIZE, the largest width and height of an
+ * animation packed into an atlas. It is disabled by default.
+ */
+class VectorAnimationAtlasManager
+{
+public:
+  /**
+   * @brief A region allocated in an atlas.
+   */
+  struct Region
+  {
+    Dali::Texture texture;     ///< The atlas texture
+    Vector4       textureRect; ///< The region in texture coordinates, (x, y, width, height)
+    uint32_t      atlasId{0u}; ///< The id of the atlas, zero if not allocated
+    uint32_t      x{0u};       ///< The x offset of the region in pixels
+    uint32_t      y{0u};       ///< The y offset of the region in pixels
+    uint32_t      width{0u};   ///< The width of the region in pixels
+    uint32_t      height{0u};  ///< The height of the region in pixels
+  };
+
+  /**
+   * @brief Create or retrieve VectorAnimationAtlasManager singleton.
+   *
+   * @return A reference to the VectorAnimationAtlasManager.
+   */
+  static VectorAnimationAtlasManager& Get();
+
+  /**
+   * @brief Retrieves whether an animation of the size can be packed into an atlas.
+   *
+   * @param[in] width The width of the animation
+   * @param[in] height The height of the animation
+   * @return True if atlasing is enabled and the size is small enough, false otherwise.
+   */
+  bool IsAtlasable(uint32_t width, uint32_t height) const;
+
+  /**
+   * @brief Allocates a region. This function is called in the main thread.
+   *
+   * @param[in] frameRate The frame rate of the animation
+   * @param[in] width The width of the animation
+   * @param[in] height The height of the animation
+   * @param[out] region The allocated region
+   * @return True if allocated, false if the animation should use its own texture.
+   */
+  bool Allocate(float frameRate, uint32_t width, uint32_t height, Region& region);
+
+  /**
+   * @brief Releases the region. It can be called in any thread.
+   *
+   * @param[in] region The region to release
+   */
+  void Release(const Region& region);
+
+  /**
+   * @brief Copies the pixels of a frame into the region. This function is called in the main thread.
+   *
+   * @param[in] region The region to update
+   * @param[in] pixelBuffer The frame, which has the size of the region and the format of the atlas
+   */
+  void UpdateRegion(const Region& region, Dali::Devel::PixelBuffer pixelBuffer);
+
+  /**
+   * @brief Uploads the changed rows of the atlases. This function is called in the main thread.
+   */
+  void UploadAtlases();
+
+private:
+  struct Atlas;
+
+  /**
+   * @brief Constructor.
+   */
+  VectorAnimationAtlasManager();
+
+  /**
+   * @brief Destructor.
+   */
+  ~VectorAnimationAtlasManager();
+
+  // Undefined
+  VectorAnimationAtlasManager(const VectorAnimationAtlasManager&) = delete;
+
+  // Undefined
+  VectorAnimationAtlasManager& operator=(const VectorAnimationAtlasManager&) = delete;
+
+  /**
+   * @brief Finds the atlas of the id. This Method is called inside mMutex.
+   */
+  Atlas* FindAtlas(uint32_t atlasId);
+
+private:
+  std::vector<std::unique_ptr<Atlas>> mAtlases;
+  Dali::Mutex                         mMutex;         ///< Mutex. Release() can be called by any thread.
+  uint32_t                            mMaxRegionSize; ///< The largest width and height packed into an atlas, zero if disabled
+  uint32_t                            mNextAtlasId;
+};
+
+} // namespace Plugin
+
+} // namespace Dali
+
+#endif // DALI_VECTOR_ANIMATION_ATLAS_MANAGER_H
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-extension/vector-animation-renderer/vector-animation-headless-renderer.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
+#include <dali/devel-api/common/hash.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+namespace Dali
+{
+namespace Plugin
+{
+namespace
+{
+constexpr uint32_t BYTES_PER_PIXEL = 4u;
+
+/**
+ * @brief Converts premultiplied BGRA8888 pixels to RGBA8888 pixels with straight alpha.
+ */
+void ConvertToStraightRgba(const uint8_t* source, size_t stride, uint32_t width, uint32_t height, uint8_t* destination)
+{
+  for(uint32_t y = 0u; y < height; ++y)
+  {
+    const uint8_t* src = source + y * stride;
+    for(uint32_t x = 0u; x < width; ++x, src += BYTES_PER_PIXEL, destination += BYTES_PER_PIXEL)
+    {
+      const uint32_t alpha = src[3];
+      if(alpha == 0u)
+      {
+        destination[0] = destination[1] = destination[2] = destination[3] = 0u;
+        continue;
+      }
+
+      destination[0] = static_cast<uint8_t>(std::min(255u, (src[2] * 255u + alpha / 2u) / alpha));
+      destination[1] = static_cast<uint8_t>(std::min(255u, (src[1] * 255u + alpha / 2u) / alpha));
+      destination[2] = static_cast<uint8_t>(std::min(255u, (src[0] * 255u + alpha / 2u) / alpha));
+      destination[3] = static_cast<uint8_t>(alpha);
+    }
+  }
+}
+
+bool WriteRawFile(const std::string& path, const uint8_t* buffer, size_t size)
+{
+  FILE* file = std::fopen(path.c_str(), "wb");
+  if(!file)
+  {
+    return false;
+  }
+
+  const bool written = (std::fwrite(buffer, 1u, size, file) == size);
+  return (std::fclose(file) == 0) && written;
+}
+
+} // unnamed namespace
+
+VectorAnimationHeadlessRenderer::VectorAnimationHeadlessRenderer()
+: mUrl(),
+  mJsonData(),
+  mCacheKey(),
+  mAnimation(),
+  mTotalFrameNumber(0),
+  mFrameRate(0.0f),
+  mDefaultWidth(0),
+  mDefaultHeight(0),
+  mThreadCount(0),
+  mEnableAspectFit(true)
+{
+}
+
+VectorAnimationHeadlessRenderer::~VectorAnimationHeadlessRenderer() = default;
+
+bool VectorAnimationHeadlessRenderer::Load(const std::string& url)
+{
+  mUrl = url;
+  mJsonData.clear();
+  mCacheKey.clear();
+
+  mAnimation = CreateAnimation();
+  if(!mAnimation)
+  {
+    DALI_LOG_ERROR("Failed to load a Lottie file [%s] [%p]\n", mUrl.c_str(), this);
+    return false;
+  }
+
+  mTotalFrameNumber = static_cast<uint32_t>(mAnimation->totalFrame());
+  mFrameRate        = static_cast<float>(mAnimation->frameRate());
+
+  size_t w, h;
+  mAnimation->size(w, h);
+  mDefaultWidth  = static_cast<uint32_t>(w);
+  mDefaultHeight = static_cast<uint32_t>(h);
+
+  return true;
+}
+
+bool VectorAnimationHeadlessRenderer::Load(const Dali::Vector<uint8_t>& data)
+{
+  mUrl.clear();
+  mJsonData = std::string(data.Begin(), data.End());
+  mCacheKey = std::to_string(Dali::CalculateHash(data)); ///< Shares the parsed model between the workers.
+
+  mAnimation = CreateAnimation();
+  if(!mAnimation)
+  {
+    DALI_LOG_ERROR("Failed to load a Lottie data [data size : %zu byte] [%p]\n", data.Size(), this);
+    return false;
+  }
+
+  mTotalFrameNumber = static_cast<uint32_t>(mAnimation->totalFrame());
+  mFrameRate        = static_cast<float>(mAnimation->frameRate());
+
+  size_t w, h;
+  mAnimation->size(w, h);
+  mDefaultWidth  = static_cast<uint32_t>(w);
+  mDefaultHeight = static_cast<uint32_t>(h);
+
+  return true;
+}
+
+void VectorAnimationHeadlessRenderer::SetEnableAspectFit(bool enable)
+{
+  mEnableAspectFit = enable;
+}
+
+void VectorAnimationHeadlessRenderer::SetThreadCount(uint32_t threadCount)
+{
+  mThreadCount = threadCount;
+}
+
+uint32_t VectorAnimationHeadlessRenderer::GetTotalFrameNumber() const
+{
+  return mTotalFrameNumber;
+}
+
+float VectorAnimationHeadlessRenderer::GetFrameRate() const
+{
+  return mFrameRate;
+}
+
+void VectorAnimationHeadlessRenderer::GetDefaultSize(uint32_t& width, uint32_t& height) const
+{
+  width  = mDefaultWidth;
+  height = mDefaultHeight;
+}
+
+bool VectorAnimationHeadlessRenderer::RenderFrames(uint32_t startFrame, uint32_t endFrame, uint32_t width, uint32_t height, uint8_t* buffer, size_t stride)
+{
+  if(!buffer || stride < width * BYTES_PER_PIXEL || stride % BYTES_PER_PIXEL != 0u || !IsValidRequest(startFrame, endFrame, width, height))
+  {
+    return false;
+  }
+
+  const size_t frameSize = stride * height;
+  return RunParallel(startFrame, endFrame, [&](rlottie::Animation& animation, std::vector<uint8_t>& scratch, uint32_t frameNumber) {
+    rlottie::Surface surface(reinterpret_cast<uint32_t*>(buffer + (frameNumber - startFrame) * frameSize), width, height, stride);
+    animation.renderSync(frameNumber, surface, mEnableAspectFit);
+    return true;
+  });
+}
+
+bool VectorAnimationHeadlessRenderer::RenderFrames(uint32_t startFrame, uint32_t endFrame, uint32_t width, uint32_t height, FrameCallback callback)
+{
+  if(!callback || !IsValidRequest(startFrame, endFrame, width, height))
+  {
+    return false;
+  }
+
+  const size_t stride = width * BYTES_PER_PIXEL;
+  return RunParallel(startFrame, endFrame, [&](rlottie::Animation& animation, std::vector<uint8_t>& scratch, uint32_t frameNumber) {
+    scratch.resize(stride * height);
+    rlottie::Surface surface(reinterpret_cast<uint32_t*>(scratch.data()), width, height, stride);
+    animation.renderSync(frameNumber, surface, mEnableAspectFit);
+    return callback(frameNumber, scratch.data(), width, height, stride);
+  });
+}
+
+bool VectorAnimationHeadlessRenderer::DumpFrames(uint32_t startFrame, uint32_t endFrame, uint32_t width, uint32_t height, const std::string& pathPrefix, FileFormat format)
+{
+  const size_t frameSize = static_cast<size_t>(width) * height * BYTES_PER_PIXEL;
+
+  return RenderFrames(startFrame, endFrame, width, height, [&](uint32_t frameNumber, const uint8_t* buffer, uint32_t frameWidth, uint32_t frameHeight, size_t stride) {
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), "%05u%s", frameNumber, (format == FileFormat::PNG) ? ".png" : ".raw");
+    const std::string path = pathPrefix + suffix;
+
+    bool written;
+    if(format == FileFormat::PNG)
+    {
+      // The encoder takes RGBA8888 with straight alpha, so convert per frame into the worker's own memory.
+      std::unique_ptr<uint8_t[]> pixels(new uint8_t[frameSize]);
+      ConvertToStraightRgba(buffer, stride, frameWidth, frameHeight, pixels.get());
+      written = Dali::EncodeToFile(pixels.get(), path, Pixel::RGBA8888, frameWidth, frameHeight);
+    }
+    else
+    {
+      written = WriteRawFile(path, buffer, frameSize);
+    }
+
+    if(!written)
+    {
+      DALI_LOG_ERROR("Failed to write frame %u to [%s] [%p]\n", frameNumber, path.c_str(), this);
+    }
+    return written;
+  });
+}
+
+std::unique_ptr<rlottie::Animation> VectorAnimationHeadlessRenderer::CreateAnimation() const
+{
+  if(!mUrl.empty())
+  {
+    return rlottie::Animation::loadFromFile(mUrl);
+  }
+  if(!mJsonData.empty())
+  {
+    return rlottie::Animation::loadFromData(mJsonData, mCacheKey);
+  }
+  return nullptr;
+}
+
+bool VectorAnimationHeadlessRenderer::IsValidRequest(uint32_t startFrame, uint32_t endFrame, uint32_t width, uint32_t height) const
+{
+  if(!mAnimation)
+  {
+    DALI_LOG_ERROR("Animation is not loaded [%p]\n", this);
+    return false;
+  }
+  if(startFrame > endFrame || endFrame >= mTotalFrameNumber || width == 0u || height == 0u)
+  {
+    DALI_LOG_ERROR("Invalid request [%u - %u, total %u] [%u x %u] [%p]\n", startFrame, endFrame, mTotalFrameNumber, width, height, this);
+    return false;
+  }
+  return true;
+}
+
+bool VectorAnimationHeadlessRenderer::RunParallel(uint32_t startFrame, uint32_t endFrame, const std::function<bool(rlottie::Animation&, std::vector<uint8_t>&, uint32_t)>& job)
+{
+  const uint32_t frameCount  = endFrame - startFrame + 1u;
+  uint32_t       threadCount = (mThreadCount > 0u) ? mThreadCount : std::thread::hardware_concurrency();
+  threadCount                = std::max(1u, std::min(threadCount, frameCount));
+
+  std::atomic<uint32_t> nextFrame{startFrame};
+  std::atomic<bool>     failed{false};
+
+  // Frames are handed out one by one, so a worker which gets cheap frames takes more of them.
+  auto work = [&](rlottie::Animation* animation) {
+    std::unique_ptr<rlottie::Animation> ownAnimation;
+    if(!animation)
+    {
+      ownAnimation = CreateAnimation();
+      animation    = ownAnimation.get();
+    }
+    if(!animation)
+    {
+      failed = true;
+      return;
+    }
+
+    std::vector<uint8_t> scratch;
+    for(uint32_t frameNumber = nextFrame++; frameNumber <= endFrame && !failed; frameNumber = nextFrame++)
+    {
+      if(!job(*animation, scratch, frameNumber))
+      {
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(threadCount - 1u);
+  for(uint32_t i = 1u; i < threadCount; ++i)
+  {
+    workers.emplace_back(work, nullptr);
+  }
+
+  // The calling thread works too, with the animation created by Load().
+  work(mAnimation.get());
+
+  for(auto& worker : workers)
+  {
+    worker.join();
+  }
+
+  return !failed;
+}
+
+} // namespace Plugin
+
+} // namespace Dali
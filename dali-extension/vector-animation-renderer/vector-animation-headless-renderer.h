@@ -0,0 +1,215 @@
+#ifndef DALI_VECTOR_ANIMATION_HEADLESS_RENDERER_H
+#define DALI_VECTOR_ANIMATION_HEADLESS_RENDERER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/vector-wrapper.h>
+#include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <rlottie.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace Dali
+{
+namespace Plugin
+{
+/**
+ * @brief Renders vector animation frames without an adaptor, an event thread or a GL context.
+ *
+ * Frames are rasterized by rlottie into memory supplied by the caller, or written to files.
+ * A frame range is split between worker threads, each of which owns its own rlottie animation
+ * and surface. rlottie shares the parsed model between them, so a worker only adds its render tree.
+ * The output pixels are premultiplied BGRA8888, the same as VectorAnimationRendererX uploads.
+ */
+class DALI_EXPORT_API VectorAnimationHeadlessRenderer
+{
+public:
+  /**
+   * @brief The file format of the dumped frames.
+   */
+  enum class FileFormat
+  {
+    RAW, ///< Premultiplied BGRA8888 pixels without a header, written with the ".raw" extension
+    PNG  ///< RGBA8888 pixels with straight alpha, written with the ".png" extension
+  };
+
+  /**
+   * @brief Called by a worker for each rendered frame.
+   *
+   * @param[in] frameNumber The frame number
+   * @param[in] buffer The rendered pixels. It is valid only during the call.
+   * @param[in] width The width of the frame
+   * @param[in] height The height of the frame
+   * @param[in] stride The stride of the buffer in bytes
+   * @return false to stop rendering
+   */
+  using FrameCallback = std::function<bool(uint32_t frameNumber, const uint8_t* buffer, uint32_t width, uint32_t height, size_t stride)>;
+
+  /**
+   * @brief Constructor.
+   */
+  VectorAnimationHeadlessRenderer();
+
+  /**
+   * @brief Destructor.
+   */
+  ~VectorAnimationHeadlessRenderer();
+
+  VectorAnimationHeadlessRenderer(const VectorAnimationHeadlessRenderer&) = delete;
+  VectorAnimationHeadlessRenderer& operator=(const VectorAnimationHeadlessRenderer&) = delete;
+
+  /**
+   * @brief Loads the animation file.
+   *
+   * @param[in] url The url of the vector animation file
+   * @return True if loading success, false otherwise.
+   */
+  bool Load(const std::string& url);
+
+  /**
+   * @brief Loads the animation from the data.
+   *
+   * @param[in] data The json contents of the vector animation
+   * @return True if loading success, false otherwise.
+   */
+  bool Load(const Dali::Vector<uint8_t>& data);
+
+  /**
+   * @brief Sets whether the animation keeps its aspect ratio in the frame.
+   *
+   * @param[in] enable True to fit the animation to the frame keeping its aspect ratio, which is the default.
+   */
+  void SetEnableAspectFit(bool enable);
+
+  /**
+   * @brief Sets the number of the worker threads.
+   *
+   * @param[in] threadCount The number of the threads. 0 uses the number of the hardware threads, which is the default.
+   */
+  void SetThreadCount(uint32_t threadCount);
+
+  /**
+   * @brief Gets the total number of frames of the file.
+   *
+   * @return The total number of frames
+   */
+  uint32_t GetTotalFrameNumber() const;
+
+  /**
+   * @brief Gets the frame rate of the file.
+   *
+   * @return The frame rate of the file
+   */
+  float GetFrameRate() const;
+
+  /**
+   * @brief Gets the default size of the file.
+   *
+   * @param[out] width The default width of the file
+   * @param[out] height The default height of the file
+   */
+  void GetDefaultSize(uint32_t& width, uint32_t& height) const;
+
+  /**
+   * @brief Renders the frames into the buffer.
+   *
+   * The frames are stored one after another. Frame N starts at buffer + (N - startFrame) * stride * height.
+   *
+   * @param[in] startFrame The first frame to render
+   * @param[in] endFrame The last frame to render, inclusive
+   * @param[in] width The width of a frame
+   * @param[in] height The height of a frame
+   * @param[in] buffer The buffer to render into. It should hold (endFrame - startFrame + 1) * stride * height bytes.
+   * @param[in] stride The stride of a row in bytes. It should be a multiple of 4 and at least width * 4.
+   * @return True if all the frames are rendered, false otherwise.
+   */
+  bool RenderFrames(uint32_t startFrame, uint32_t endFrame, uint32_t width, uint32_t height, uint8_t* buffer, size_t stride);
+
+  /**
+   * @brief Renders the frames and passes each of them to the callback.
+   *
+   * The callback is called on the worker threads, in no particular frame order.
+   *
+   * @param[in] startFrame The first frame to render
+   * @param[in] endFrame The last frame to render, inclusive
+   * @param[in] width The width of a frame
+   * @param[in] height The height of a frame
+   * @param[in] callback The callback called with each rendered frame
+   * @return True if all the frames are rendered and accepted by the callback, false otherwise.
+   */
+  bool RenderFrames(uint32_t startFrame, uint32_t endFrame, uint32_t width, uint32_t height, FrameCallback callback);
+
+  /**
+   * @brief Renders the frames and writes each of them to a file.
+   *
+   * The file of frame N is the prefix followed by N with five digits and the extension of the format,
+   * e.g. "/tmp/thumbnail-00012.png".
+   *
+   * @param[in] startFrame The first frame to render
+   * @param[in] endFrame The last frame to render, inclusive
+   * @param[in] width The width of a frame
+   * @param[in] height The height of a frame
+   * @param[in] pathPrefix The path prefix of the files
+   * @param[in] format The file format
+   * @return True if all the files are written, false otherwise.
+   */
+  bool DumpFrames(uint32_t startFrame, uint32_t endFrame, uint32_t width, uint32_t height, const std::string& pathPrefix, FileFormat format);
+
+private:
+  /**
+   * @brief Creates a new rlottie animation from the loaded source.
+   */
+  std::unique_ptr<rlottie::Animation> CreateAnimation() const;
+
+  /**
+   * @brief Checks the frame range and the size.
+   */
+  bool IsValidRequest(uint32_t startFrame, uint32_t endFrame, uint32_t width, uint32_t height) const;
+
+  /**
+   * @brief Runs the job for each frame of the range on the worker threads.
+   *
+   * @param[in] startFrame The first frame
+   * @param[in] endFrame The last frame, inclusive
+   * @param[in] job Called with the animation of the worker, the scratch memory of the worker and the frame number
+   * @return True if the job succeeds for all the frames, false otherwise.
+   */
+  bool RunParallel(uint32_t startFrame, uint32_t endFrame, const std::function<bool(rlottie::Animation&, std::vector<uint8_t>&, uint32_t)>& job);
+
+private:
+  std::string                         mUrl;           ///< The url of the file, or empty if loaded from data
+  std::string                         mJsonData;      ///< The json contents if loaded from data
+  std::string                         mCacheKey;      ///< The rlottie cache key of the json contents
+  std::unique_ptr<rlottie::Animation> mAnimation;     ///< The animation used for the properties and by the first worker
+  uint32_t                            mTotalFrameNumber;
+  float                               mFrameRate;
+  uint32_t                            mDefaultWidth;
+  uint32_t                            mDefaultHeight;
+  uint32_t                            mThreadCount;
+  bool                                mEnableAspectFit;
+};
+
+} // namespace Plugin
+
+} // namespace Dali
+
+#endif // DALI_VECTOR_ANIMATION_HEADLESS_RENDERER_H
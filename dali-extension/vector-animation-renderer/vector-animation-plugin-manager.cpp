@@ -23,6 +23,9 @@
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 
+// INTERNAL INCLUDES
+#include <dali-extension/vector-animation-renderer/vector-animation-atlas-manager.h>
+
 namespace Dali
 {
 namespace Plugin
@@ -199,6 +202,9 @@ void VectorAnimationPluginManager::OnEventTriggered()
       handler->NotifyEvent();
     }
   }
+
+  // Upload the frames copied into the atlases by the handlers.
+  VectorAnimationAtlasManager::Get().UploadAtlases();
 }
 
 } // namespace Plugin
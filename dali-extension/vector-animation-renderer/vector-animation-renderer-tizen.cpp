@@ -48,6 +48,12 @@ Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New(Debug::NoLogging,
 class VectorAnimationRendererTizen::RenderingDataImpl : public VectorAnimationRenderer::RenderingData
 {
 public:
+  void PrepareBuffer() override
+  {
+    mTargetSurface = NativeImageQueue::New(mWidth, mHeight, NativeImageQueue::ColorFormat::BGRA8888);
+    mTargetSurface->SetQueueUsageHint(Dali::NativeImageQueue::QueueUsageType::ENQUEUE_DEQUEUE);
+  }
+
   NativeImageQueuePtr mTargetSurface;
 };
 
@@ -103,6 +109,7 @@ bool VectorAnimationRendererTizen::Render(uint32_t frameNumber)
   {
     if(resourceChanged || mDecodedBuffers.size() < mTotalFrameNumber)
     {
+      StopFixedCacheWarmUp();
       mDecodedBuffers.clear();
       mDecodedBuffers.resize(mTotalFrameNumber, std::make_pair<std::vector<uint8_t>, bool>(std::vector<uint8_t>(), false));
     }
@@ -127,6 +134,11 @@ bool VectorAnimationRendererTizen::Render(uint32_t frameNumber)
     }
   }
 
+  if(mEnableFixedCache && (frameNumber < mDecodedBuffers.size()) && (!mDecodedBuffers[frameNumber].second))
+  {
+    TakeWarmedUpBuffer(frameNumber);
+  }
+
   NativeImageQueue::BufferAccessType type;
   if(mEnableFixedCache && (frameNumber < mDecodedBuffers.size()) && (!mDecodedBuffers[frameNumber].second))
   {
@@ -163,6 +175,8 @@ bool VectorAnimationRendererTizen::Render(uint32_t frameNumber)
     // Create Surface object
     rlottie::Surface surface = rlottie::Surface(reinterpret_cast<uint32_t*>(buffer), renderingDataImpl->mWidth, renderingDataImpl->mHeight, static_cast<size_t>(stride));
 
+    ++mRenderCount;
+
     // Render the frame
     // mEnableAspectFit: true = keep aspect ratio (aspect fit mode), false = stretch to fit
     mVectorRenderer->renderSync(frameNumber, surface, mEnableAspectFit);
@@ -178,6 +192,12 @@ bool VectorAnimationRendererTizen::Render(uint32_t frameNumber)
 
   renderingDataImpl->mTargetSurface->EnqueueBuffer(buffer);
 
+  if(mEnableFixedCache && !mWarmUpState)
+  {
+    // The stride of the queue is known now. Rasterize the other frames in parallel.
+    StartFixedCacheWarmUp(renderingDataImpl->mWidth, renderingDataImpl->mHeight, static_cast<size_t>(stride));
+  }
+
   if(!mResourceReady)
   {
     // Only move the ownership of the texture to the renderer when it is valid.
@@ -234,14 +254,11 @@ void VectorAnimationRendererTizen::OnNotify()
   mPreviousTextures.clear();
 }
 
-// This Method is called inside mRenderingDataMutex
+// This function is called in the main thread.
 void VectorAnimationRendererTizen::PrepareTarget(std::shared_ptr<RenderingData> renderingData)
 {
   std::shared_ptr<RenderingDataImpl> renderingDataImpl = std::static_pointer_cast<RenderingDataImpl>(renderingData);
-  renderingDataImpl->mTargetSurface                    = NativeImageQueue::New(renderingDataImpl->mWidth, renderingDataImpl->mHeight, NativeImageQueue::ColorFormat::BGRA8888);
   renderingDataImpl->mTexture                          = Texture::New(*renderingDataImpl->mTargetSurface);
-
-  renderingDataImpl->mTargetSurface->SetQueueUsageHint(Dali::NativeImageQueue::QueueUsageType::ENQUEUE_DEQUEUE);
 }
 
 bool VectorAnimationRendererTizen::IsTargetPrepared()
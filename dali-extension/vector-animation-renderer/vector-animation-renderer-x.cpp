@@ -27,6 +27,7 @@
 #include <cstring> // for strlen()
 
 // INTERNAL INCLUDES
+#include <dali-extension/vector-animation-renderer/vector-animation-atlas-manager.h>
 #include <dali-extension/vector-animation-renderer/vector-animation-plugin-manager.h>
 
 // The plugin factories
@@ -49,8 +50,34 @@ Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New(Debug::NoLogging,
 class VectorAnimationRendererX::RenderingDataImpl : public VectorAnimationRenderer::RenderingData
 {
 public:
-  rlottie::Surface         mLottieSurface;
-  Dali::Devel::PixelBuffer mPixelBuffer;
+  ~RenderingDataImpl()
+  {
+    if(mAtlasRegion.atlasId != 0u)
+    {
+      VectorAnimationAtlasManager::Get().Release(mAtlasRegion);
+    }
+  }
+
+  void PrepareBuffer() override
+  {
+    mPixelBuffer   = Dali::Devel::PixelBuffer::New(mWidth, mHeight, Dali::Pixel::BGRA8888);
+    mLottieSurface = rlottie::Surface(reinterpret_cast<uint32_t*>(mPixelBuffer.GetBuffer()), mWidth, mHeight, static_cast<size_t>(mPixelBuffer.GetStrideBytes()));
+  }
+
+  size_t GetReusableMemorySize() const override
+  {
+    // An atlas region is kept by the atlas of the frame rate of its renderer.
+    if(!mPixelBuffer || !mTexture || mAtlasRegion.atlasId != 0u)
+    {
+      return 0u;
+    }
+    // The pixel buffer and the texture
+    return 2u * static_cast<size_t>(mPixelBuffer.GetStrideBytes()) * mHeight;
+  }
+
+  rlottie::Surface                    mLottieSurface;
+  Dali::Devel::PixelBuffer            mPixelBuffer;
+  VectorAnimationAtlasManager::Region mAtlasRegion; ///< The region of the shared atlas if mTexture is an atlas
 };
 
 VectorAnimationRendererX::VectorAnimationRendererX()
@@ -105,6 +132,8 @@ bool VectorAnimationRendererX::Render(uint32_t frameNumber)
     return false;
   }
 
+  ++mRenderCount;
+
   // Render the frame
   // mEnableAspectFit: true = keep aspect ratio (aspect fit mode), false = stretch to fit
   mVectorRenderer->renderSync(frameNumber, renderingDataImpl->mLottieSurface, mEnableAspectFit);
@@ -151,20 +180,35 @@ void VectorAnimationRendererX::OnNotify()
 
   if(renderingDataImpl && renderingDataImpl->mPixelBuffer && renderingDataImpl->mTexture)
   {
-    PixelData pixelData = renderingDataImpl->mPixelBuffer.CreatePixelData();
-    renderingDataImpl->mTexture.Upload(pixelData);
+    if(renderingDataImpl->mAtlasRegion.atlasId != 0u)
+    {
+      // The atlas is uploaded once after all the animations are notified.
+      VectorAnimationAtlasManager::Get().UpdateRegion(renderingDataImpl->mAtlasRegion, renderingDataImpl->mPixelBuffer);
+    }
+    else
+    {
+      PixelData pixelData = renderingDataImpl->mPixelBuffer.CreatePixelData();
+      renderingDataImpl->mTexture.Upload(pixelData);
+    }
 
     mUploadPixelBufferRequired = false;
   }
 }
 
-// This Method is called inside mRenderingDataMutex
+// This function is called in the main thread.
 void VectorAnimationRendererX::PrepareTarget(std::shared_ptr<RenderingData> renderingData)
 {
   std::shared_ptr<RenderingDataImpl> renderingDataImpl = std::static_pointer_cast<RenderingDataImpl>(renderingData);
-  renderingDataImpl->mTexture                          = Texture::New(Dali::TextureType::TEXTURE_2D, Dali::Pixel::BGRA8888, renderingDataImpl->mWidth, renderingDataImpl->mHeight);
-  renderingDataImpl->mPixelBuffer                      = Dali::Devel::PixelBuffer::New(renderingDataImpl->mWidth, renderingDataImpl->mHeight, Dali::Pixel::BGRA8888);
-  renderingDataImpl->mLottieSurface                    = rlottie::Surface(reinterpret_cast<uint32_t*>(renderingDataImpl->mPixelBuffer.GetBuffer()), renderingDataImpl->mWidth, renderingDataImpl->mHeight, static_cast<size_t>(renderingDataImpl->mPixelBuffer.GetStrideBytes()));
+
+  auto& atlasManager = VectorAnimationAtlasManager::Get();
+  if(atlasManager.IsAtlasable(renderingDataImpl->mWidth, renderingDataImpl->mHeight) && atlasManager.Allocate(mFrameRate, renderingDataImpl->mWidth, renderingDataImpl->mHeight, renderingDataImpl->mAtlasRegion))
+  {
+    renderingDataImpl->mTexture = renderingDataImpl->mAtlasRegion.texture;
+  }
+  else
+  {
+    renderingDataImpl->mTexture = Texture::New(Dali::TextureType::TEXTURE_2D, Dali::Pixel::BGRA8888, renderingDataImpl->mWidth, renderingDataImpl->mHeight);
+  }
 }
 
 bool VectorAnimationRendererX::IsTargetPrepared()
@@ -208,6 +252,20 @@ Dali::Texture VectorAnimationRendererX::GetTargetTexture()
   return (renderingDataImpl) ? renderingDataImpl->mTexture : Texture();
 }
 
+// This Method is called inside mMutex
+Vector4 VectorAnimationRendererX::GetTargetTextureRect()
+{
+  std::shared_ptr<RenderingDataImpl> renderingDataImpl;
+  {
+    Dali::Mutex::ScopedLock lock(mRenderingDataMutex);
+    if(DALI_LIKELY(!mFinalized))
+    {
+      renderingDataImpl = std::static_pointer_cast<RenderingDataImpl>(mCurrentRenderingData);
+    }
+  }
+  return (renderingDataImpl && renderingDataImpl->mAtlasRegion.atlasId != 0u) ? renderingDataImpl->mAtlasRegion.textureRect : VectorAnimationRenderer::GetTargetTextureRect();
+}
+
 // This Method is called inside mRenderingDataMutex
 std::shared_ptr<VectorAnimationRenderer::RenderingData> VectorAnimationRendererX::CreateRenderingData()
 {
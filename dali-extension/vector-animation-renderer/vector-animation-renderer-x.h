@@ -88,6 +88,11 @@ private:
    */
   Dali::Texture GetTargetTexture() override;
 
+  /**
+   * @copydoc VectorAnimationRenderer::GetTargetTextureRect()
+   */
+  Vector4 GetTargetTextureRect() override;
+
   /**
    * @copydoc VectorAnimationRenderer::CreateRenderingData()
    */
@@ -19,14 +19,23 @@
 #include <dali-extension/vector-animation-renderer/vector-animation-renderer.h>
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/common/hash.h>
+#include <dali/devel-api/threading/conditional-wait.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include <dali/integration-api/texture-integ.h>
 #include <dali/public-api/object/property-array.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <cstring> // for strlen()
+#include <deque>
+#include <functional>
+#include <list>
+#include <thread>
 
 // INTERNAL INCLUDES
 #include <dali-extension/vector-animation-renderer/vector-animation-plugin-manager.h>
@@ -42,13 +51,296 @@ namespace
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_VECTOR_ANIMATION");
 #endif
+
+const char* const PIXEL_AREA_UNIFORM_NAME = "pixelArea";
+const Vector4     FULL_TEXTURE_RECT(0.0f, 0.0f, 1.0f, 1.0f);
+
+constexpr uint32_t DEFAULT_RENDERING_DATA_POOL_SIZE_KB = 8u * 1024u;
+constexpr auto     RENDERING_DATA_POOL_SIZE_ENV        = "DALI_VECTOR_ANIMATION_POOL_SIZE_KB";
+
+constexpr uint32_t WARM_UP_FRAMES_PER_JOB = 8u;
+
+bool ConvertToColor(const Property::Value& value, rlottie::Color& color)
+{
+  Vector3 vector;
+  if(value.Get(vector))
+  {
+    color = rlottie::Color(vector.r, vector.g, vector.b);
+    return true;
+  }
+  return false;
+}
+
+bool ConvertToOpacity(const Property::Value& value, float& opacity)
+{
+  if(value.Get(opacity))
+  {
+    opacity *= 100.0f;
+    return true;
+  }
+  return false;
+}
+
+bool ConvertToFloat(const Property::Value& value, float& result)
+{
+  return value.Get(result);
+}
+
+bool ConvertToPoint(const Property::Value& value, rlottie::Point& point)
+{
+  Vector2 vector;
+  if(value.Get(vector))
+  {
+    point = rlottie::Point(vector.x, vector.y);
+    return true;
+  }
+  return false;
+}
+
+bool ConvertToSize(const Property::Value& value, rlottie::Size& size)
+{
+  Vector2 vector;
+  if(value.Get(vector))
+  {
+    size = rlottie::Size(vector.x, vector.y);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Retrieves the value of a dynamic property from the callback once per rendered frame.
+ *
+ * rlottie asks the value for every content matching the key path, so a key path with wildcards would
+ * execute the callback and convert its Property::Value many times per frame. The converted value is
+ * kept until the frame number or the render count changes.
+ */
+template<typename T>
+class DynamicPropertyGetter
+{
+public:
+  using Converter = bool (*)(const Property::Value&, T&);
+
+  DynamicPropertyGetter(CallbackBase& callback, int32_t id, VectorAnimationRendererPlugin::VectorProperty property, const uint32_t& renderCount, T defaultValue, Converter converter)
+  : mCallback(&callback),
+    mRenderCount(&renderCount),
+    mCache(std::make_shared<Cache>()),
+    mDefaultValue(defaultValue),
+    mConverter(converter),
+    mId(id),
+    mProperty(property)
+  {
+  }
+
+  T operator()(const rlottie::FrameInfo& info) const
+  {
+    Cache& cache = *mCache;
+    if(!cache.valid || cache.frame != info.curFrame() || cache.renderCount != *mRenderCount)
+    {
+      Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*mCallback, mId, mProperty, info.curFrame());
+      if(!mConverter(value, cache.value))
+      {
+        cache.value = mDefaultValue;
+      }
+      cache.frame       = info.curFrame();
+      cache.renderCount = *mRenderCount;
+      cache.valid       = true;
+    }
+    return cache.value;
+  }
+
+private:
+  struct Cache
+  {
+    T        value{};
+    size_t   frame{0u};
+    uint32_t renderCount{0u};
+    bool     valid{false};
+  };
+
+  CallbackBase*                                 mCallback;
+  const uint32_t*                               mRenderCount; ///< Owned by the renderer, which owns the animation calling this
+  std::shared_ptr<Cache>                        mCache;       ///< Shared by the copies made by rlottie
+  T                                             mDefaultValue;
+  Converter                                     mConverter;
+  int32_t                                       mId;
+  VectorAnimationRendererPlugin::VectorProperty mProperty;
+};
 } // unnamed namespace
 
+/**
+ * @brief Allocates the buffer of a rendering data in a worker thread.
+ */
+class VectorAnimationRenderer::PrepareBufferTask : public Dali::AsyncTask
+{
+public:
+  PrepareBufferTask(std::shared_ptr<RenderingData> renderingData, CallbackBase* completedCallback)
+  : Dali::AsyncTask(completedCallback),
+    mRenderingData(std::move(renderingData))
+  {
+  }
+
+  void Process() override
+  {
+    mRenderingData->PrepareBuffer();
+  }
+
+  bool IsReady() override
+  {
+    return true;
+  }
+
+  std::shared_ptr<RenderingData> mRenderingData;
+};
+
+/**
+ * @brief Keeps the prepared targets of the previous sizes, so a renderer resized to a size used before doesn't allocate.
+ *
+ * It is used in the main thread only. The least recently pooled targets are dropped above the memory limit,
+ * which is DALI_VECTOR_ANIMATION_POOL_SIZE_KB or 8 MB by default.
+ */
+class VectorAnimationRenderer::RenderingDataPool
+{
+public:
+  static RenderingDataPool& Get()
+  {
+    // Not destroyed at exit, because the pooled textures can not be released after the adaptor is destroyed.
+    static RenderingDataPool* pool = new RenderingDataPool();
+    return *pool;
+  }
+
+  std::shared_ptr<RenderingData> Acquire(uint32_t width, uint32_t height, Pixel::Format format)
+  {
+    // Search from the most recently pooled one.
+    for(auto iter = mRenderingData.rbegin(); iter != mRenderingData.rend(); ++iter)
+    {
+      if((*iter)->mWidth == width && (*iter)->mHeight == height && (*iter)->mFormat == format)
+      {
+        std::shared_ptr<RenderingData> renderingData = std::move(*iter);
+        mRenderingData.erase(std::next(iter).base());
+        mMemorySize -= renderingData->GetReusableMemorySize();
+        return renderingData;
+      }
+    }
+    return nullptr;
+  }
+
+  void Release(std::shared_ptr<RenderingData>& renderingData)
+  {
+    // A texture still in a texture set may be displayed, so it must not get the frames of another renderer.
+    const bool   textureInUse = renderingData->mTexture && renderingData->mTexture.GetBaseObject().ReferenceCount() > 1;
+    const size_t memorySize   = (renderingData.use_count() == 1 && !textureInUse) ? renderingData->GetReusableMemorySize() : 0u;
+    if(memorySize == 0u || memorySize > mMemoryLimit)
+    {
+      return;
+    }
+
+    mMemorySize += memorySize;
+    mRenderingData.push_back(std::move(renderingData));
+
+    while(mMemorySize > mMemoryLimit)
+    {
+      mMemorySize -= mRenderingData.front()->GetReusableMemorySize();
+      mRenderingData.pop_front();
+    }
+  }
+
+private:
+  RenderingDataPool()
+  : mRenderingData(),
+    mMemorySize(0u),
+    mMemoryLimit(DEFAULT_RENDERING_DATA_POOL_SIZE_KB * 1024u)
+  {
+    if(const char* sizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(RENDERING_DATA_POOL_SIZE_ENV))
+    {
+      mMemoryLimit = static_cast<size_t>(std::strtoul(sizeString, nullptr, 10)) * 1024u;
+    }
+  }
+
+  std::list<std::shared_ptr<RenderingData>> mRenderingData; ///< Ordered by the time it is pooled
+  size_t                                    mMemorySize;
+  size_t                                    mMemoryLimit;
+};
+
+/**
+ * @brief The frames rasterized for the fixed cache of a renderer, shared with the warm up jobs.
+ */
+struct VectorAnimationRenderer::WarmUpState
+{
+  Dali::Mutex                       mMutex;           ///< Mutex for mBuffers. We cannot lock any mutex under this scope.
+  std::vector<std::vector<uint8_t>> mBuffers;         ///< The rasterized frames, not taken yet
+  std::atomic<bool>                 mCancelled{false}; ///< Whether the jobs should drop their frames
+};
+
+/**
+ * @brief Runs the warm up jobs of all the renderers on a few worker threads.
+ *
+ * The jobs are run in the order they are added, so the frames of a renderer are ready from the beginning.
+ * Half of the cores are left to the event, render and vector animation threads.
+ */
+class VectorAnimationRenderer::WarmUpPool
+{
+public:
+  static WarmUpPool& Get()
+  {
+    // Not destroyed at exit, because the workers may still be running a job.
+    static WarmUpPool* pool = new WarmUpPool();
+    return *pool;
+  }
+
+  void AddJob(std::function<void()> job)
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    mJobs.push_back(std::move(job));
+
+    // Start the workers when the first job comes.
+    if(mThreads.empty())
+    {
+      const uint32_t threadCount = std::max(1u, std::thread::hardware_concurrency() / 2u);
+      for(uint32_t i = 0u; i < threadCount; ++i)
+      {
+        mThreads.emplace_back(&WarmUpPool::Run, this);
+      }
+    }
+    mConditionalWait.Notify(lock);
+  }
+
+private:
+  WarmUpPool() = default;
+
+  void Run()
+  {
+    while(true)
+    {
+      std::function<void()> job;
+      {
+        ConditionalWait::ScopedLock lock(mConditionalWait);
+        while(mJobs.empty())
+        {
+          mConditionalWait.Wait(lock);
+        }
+        job = std::move(mJobs.front());
+        mJobs.pop_front();
+      }
+      job();
+    }
+  }
+
+  ConditionalWait                   mConditionalWait; ///< Guards mJobs
+  std::deque<std::function<void()>> mJobs;
+  std::vector<std::thread>          mThreads;
+};
+
 VectorAnimationRenderer::VectorAnimationRenderer()
 : mUrl(),
   mMutex(),
   mRenderingDataMutex(),
+  mWarmUpState(),
   mRenderer(),
+  mPixelArea(FULL_TEXTURE_RECT),
+  mTargetPixelArea(FULL_TEXTURE_RECT),
+  mPixelAreaIndex(Property::INVALID_INDEX),
+  mRenderCount(0u),
   mVectorRenderer(),
   mUploadCompletedSignal(),
   mTotalFrameNumber(0),
@@ -67,22 +359,148 @@ VectorAnimationRenderer::VectorAnimationRenderer()
 
 VectorAnimationRenderer::~VectorAnimationRenderer()
 {
+  CancelPrepareBufferTask();
+  StopFixedCacheWarmUp();
+
   // Ensure the rendering data removed after Render finisehd at VectorAnimationTaskThread.
   mCurrentRenderingData.reset();
 }
 
+// This Method is called inside mMutex
+Vector4 VectorAnimationRenderer::GetTargetTextureRect()
+{
+  return FULL_TEXTURE_RECT;
+}
+
+Pixel::Format VectorAnimationRenderer::GetTargetFormat() const
+{
+  return Pixel::BGRA8888;
+}
+
+// This Method is called inside mMutex
+void VectorAnimationRenderer::SetTargetTexture(Renderer& renderer)
+{
+  TextureSet textureSet = renderer.GetTextures();
+  textureSet.SetTexture(0, GetTargetTexture());
+
+  // Do not register the pixel area until the target is a part of a texture, e.g. an atlas.
+  const Vector4 textureRect = GetTargetTextureRect();
+  if(textureRect != FULL_TEXTURE_RECT || mPixelAreaIndex != Property::INVALID_INDEX)
+  {
+    mTargetPixelArea = Vector4(textureRect.x + mPixelArea.x * textureRect.z, textureRect.y + mPixelArea.y * textureRect.w, mPixelArea.z * textureRect.z, mPixelArea.w * textureRect.w);
+    mPixelAreaIndex  = renderer.RegisterProperty(PIXEL_AREA_UNIFORM_NAME, mTargetPixelArea);
+  }
+}
+
 // This Method is called inside mRenderingDataMutex
 void VectorAnimationRenderer::ClearPreviousRenderingData()
 {
+  auto& pool = RenderingDataPool::Get();
+  for(auto& renderingData : mPreviousRenderingData)
+  {
+    if(renderingData)
+    {
+      pool.Release(renderingData);
+    }
+  }
   mPreviousRenderingData.clear();
 }
 
+// This Method is called inside mMutex
+void VectorAnimationRenderer::StartFixedCacheWarmUp(uint32_t width, uint32_t height, size_t stride)
+{
+  // Workers render with their own animations, so content which needs this animation can not be warmed up.
+  if(mUrl.empty() || !mPropertyCallbacks.empty() || mTotalFrameNumber == 0u)
+  {
+    return;
+  }
+
+  StopFixedCacheWarmUp();
+
+  // The jobs keep the state alive, so they don't touch this renderer and drop their frames once it is cancelled.
+  mWarmUpState = std::make_shared<WarmUpState>();
+  mWarmUpState->mBuffers.resize(mTotalFrameNumber);
+
+  auto& pool = WarmUpPool::Get();
+  for(uint32_t startFrame = 0u; startFrame < mTotalFrameNumber; startFrame += WARM_UP_FRAMES_PER_JOB)
+  {
+    const uint32_t endFrame = std::min(startFrame + WARM_UP_FRAMES_PER_JOB, mTotalFrameNumber);
+    pool.AddJob([state = mWarmUpState, url = mUrl, width, height, stride, enableAspectFit = bool(mEnableAspectFit), startFrame, endFrame]() {
+      if(state->mCancelled)
+      {
+        return;
+      }
+
+      // rlottie caches the parsed model by the path, so only the first job of the content parses the file.
+      std::unique_ptr<rlottie::Animation> animation = rlottie::Animation::loadFromFile(url);
+      if(!animation)
+      {
+        return;
+      }
+
+      for(uint32_t frameNumber = startFrame; frameNumber < endFrame && !state->mCancelled; ++frameNumber)
+      {
+        // Keep the layout of the target buffer, which Render() copies with a single memcpy.
+        std::vector<uint8_t> rasterizeBuffer(height * stride);
+        rlottie::Surface     surface(reinterpret_cast<uint32_t*>(rasterizeBuffer.data()), width, height, stride);
+        animation->renderSync(frameNumber, surface, enableAspectFit);
+
+        Dali::Mutex::ScopedLock lock(state->mMutex);
+        if(!state->mCancelled && frameNumber < state->mBuffers.size())
+        {
+          state->mBuffers[frameNumber] = std::move(rasterizeBuffer);
+        }
+      }
+    });
+  }
+
+  DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "Warm up the fixed cache [%u frames, %u x %u] [%p]\n", mTotalFrameNumber, width, height, this);
+}
+
+// This Method is called inside mMutex
+void VectorAnimationRenderer::StopFixedCacheWarmUp()
+{
+  if(mWarmUpState)
+  {
+    // Do not wait for the running jobs. They check the flag between the frames and release the state at the end.
+    {
+      Dali::Mutex::ScopedLock lock(mWarmUpState->mMutex);
+      mWarmUpState->mCancelled = true;
+      mWarmUpState->mBuffers.clear();
+    }
+    mWarmUpState.reset();
+  }
+}
+
+// This Method is called inside mMutex
+bool VectorAnimationRenderer::TakeWarmedUpBuffer(uint32_t frameNumber)
+{
+  if(!mWarmUpState || frameNumber >= mDecodedBuffers.size())
+  {
+    return false;
+  }
+
+  Dali::Mutex::ScopedLock lock(mWarmUpState->mMutex);
+  auto&                   buffers = mWarmUpState->mBuffers;
+  if(frameNumber < buffers.size() && !buffers[frameNumber].empty())
+  {
+    mDecodedBuffers[frameNumber].first  = std::move(buffers[frameNumber]);
+    mDecodedBuffers[frameNumber].second = true;
+    buffers[frameNumber].clear();
+    return true;
+  }
+  return false;
+}
+
 void VectorAnimationRenderer::Finalize()
 {
   Dali::Mutex::ScopedLock lock(mMutex);
 
   VectorAnimationPluginManager::Get().RemoveEventHandler(*this);
 
+  CancelPrepareBufferTask();
+  StopFixedCacheWarmUp();
+
   mVectorRenderer.reset();
   mPropertyCallbacks.clear();
 
@@ -91,6 +509,7 @@ void VectorAnimationRenderer::Finalize()
   {
     Dali::Mutex::ScopedLock lock(mRenderingDataMutex);
 
+    mPreviousRenderingData.push_back(std::move(mPreparedRenderingData));
     mPreparedRenderingData.reset();
     ClearPreviousRenderingData();
 
@@ -162,6 +581,21 @@ bool VectorAnimationRenderer::Load(const Dali::Vector<uint8_t>& data)
 
 void VectorAnimationRenderer::SetRenderer(Renderer renderer)
 {
+  // Keep the pixel area set by the visual, to combine it with the area of the target texture.
+  const Property::Index pixelAreaIndex = renderer ? renderer.GetPropertyIndex(PIXEL_AREA_UNIFORM_NAME) : Property::INVALID_INDEX;
+  const Vector4         pixelArea      = (pixelAreaIndex != Property::INVALID_INDEX) ? renderer.GetProperty<Vector4>(pixelAreaIndex) : FULL_TEXTURE_RECT;
+  if(renderer != mRenderer)
+  {
+    mPixelArea      = pixelArea;
+    mPixelAreaIndex = Property::INVALID_INDEX;
+  }
+  else if(mPixelAreaIndex == Property::INVALID_INDEX || pixelArea != mTargetPixelArea)
+  {
+    // The renderer is set again, e.g. when the visual is put back on the scene.
+    // The area registered by SetTargetTexture already has the area of the target texture applied, so it is not read back.
+    mPixelArea = pixelArea;
+  }
+
   mRenderer = renderer;
 
   bool emitSignal = false;
@@ -173,9 +607,7 @@ void VectorAnimationRenderer::SetRenderer(Renderer renderer)
 
       if(IsRenderReady())
       {
-        TextureSet textureSet = renderer.GetTextures();
-
-        textureSet.SetTexture(0, GetTargetTexture());
+        SetTargetTexture(renderer);
 
         emitSignal = true;
       }
@@ -202,6 +634,17 @@ void VectorAnimationRenderer::SetSize(uint32_t width, uint32_t height)
     return;
   }
 
+  if(mPrepareBufferTask)
+  {
+    const auto& pendingRenderingData = static_cast<PrepareBufferTask*>(mPrepareBufferTask.Get())->mRenderingData;
+    if(pendingRenderingData->mWidth == width && pendingRenderingData->mHeight == height)
+    {
+      return;
+    }
+    CancelPrepareBufferTask();
+  }
+
+  bool hasTarget = false;
   {
     Dali::Mutex::ScopedLock lock(mRenderingDataMutex);
     if(DALI_UNLIKELY(mFinalized))
@@ -219,7 +662,23 @@ void VectorAnimationRenderer::SetSize(uint32_t width, uint32_t height)
     {
       return;
     }
-    mPreparedRenderingData.reset();
+    hasTarget = mPreparedRenderingData || mCurrentRenderingData;
+  }
+
+  const Pixel::Format format = GetTargetFormat();
+
+  if(std::shared_ptr<RenderingData> pooledRenderingData = RenderingDataPool::Get().Acquire(width, height, format))
+  {
+    {
+      Dali::Mutex::ScopedLock lock(mRenderingDataMutex);
+      if(DALI_LIKELY(!mFinalized))
+      {
+        mPreparedRenderingData = std::move(pooledRenderingData);
+      }
+    }
+
+    DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "Reuse pooled target [%d x %d] [%p]\n", width, height, this);
+    return;
   }
 
   std::shared_ptr<RenderingData> preparedRenderingData = CreateRenderingData();
@@ -227,6 +686,45 @@ void VectorAnimationRenderer::SetSize(uint32_t width, uint32_t height)
   // If updated data is not used yet, do not change current data index.
   preparedRenderingData->mWidth  = width;
   preparedRenderingData->mHeight = height;
+  preparedRenderingData->mFormat = format;
+
+  // When resized, keep rendering the previous target until the buffer of the new one is allocated by a worker.
+  // The first target is prepared here, so the first frame is not delayed.
+  if(hasTarget)
+  {
+    if(Dali::AsyncTaskManager asyncTaskManager = Dali::AsyncTaskManager::Get())
+    {
+      mPrepareBufferTask = new PrepareBufferTask(preparedRenderingData, MakeCallback(this, &VectorAnimationRenderer::OnBufferPrepared));
+      asyncTaskManager.AddTask(mPrepareBufferTask);
+
+      DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "Prepare buffer asynchronously [%d x %d] [%p]\n", width, height, this);
+      return;
+    }
+  }
+
+  preparedRenderingData->PrepareBuffer();
+  PrepareTarget(preparedRenderingData);
+
+  {
+    Dali::Mutex::ScopedLock lock(mRenderingDataMutex);
+    if(DALI_LIKELY(!mFinalized))
+    {
+      mPreparedRenderingData = preparedRenderingData;
+    }
+  }
+
+  DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "width = %d, height = %d [%p]\n", preparedRenderingData->mWidth, preparedRenderingData->mHeight, this);
+}
+
+void VectorAnimationRenderer::OnBufferPrepared(AsyncTaskPtr task)
+{
+  if(task != mPrepareBufferTask)
+  {
+    return;
+  }
+  mPrepareBufferTask.Reset();
+
+  std::shared_ptr<RenderingData> preparedRenderingData = std::move(static_cast<PrepareBufferTask*>(task.Get())->mRenderingData);
 
   PrepareTarget(preparedRenderingData);
 
@@ -241,6 +739,18 @@ void VectorAnimationRenderer::SetSize(uint32_t width, uint32_t height)
   DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "width = %d, height = %d [%p]\n", preparedRenderingData->mWidth, preparedRenderingData->mHeight, this);
 }
 
+void VectorAnimationRenderer::CancelPrepareBufferTask()
+{
+  if(mPrepareBufferTask)
+  {
+    if(Dali::AsyncTaskManager asyncTaskManager = Dali::AsyncTaskManager::Get())
+    {
+      asyncTaskManager.RemoveTask(mPrepareBufferTask);
+    }
+    mPrepareBufferTask.Reset();
+  }
+}
+
 uint32_t VectorAnimationRenderer::GetTotalFrameNumber() const
 {
   return mTotalFrameNumber;
@@ -324,6 +834,9 @@ void VectorAnimationRenderer::AddPropertyValueCallback(const std::string& keyPat
 
   if(DALI_UNLIKELY(!mFinalized))
   {
+    // The warm up renders without the dynamic properties.
+    StopFixedCacheWarmUp();
+
     mPropertyCallbacks.push_back(std::unique_ptr<CallbackBase>(callback));
 
     if(mVectorRenderer)
@@ -332,184 +845,65 @@ void VectorAnimationRenderer::AddPropertyValueCallback(const std::string& keyPat
       {
         case VectorProperty::FILL_COLOR:
         {
-          mVectorRenderer->setValue<rlottie::Property::FillColor>(keyPath,
-                                                                  [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            Vector3         color;
-            if(value.Get(color))
-            {
-              return rlottie::Color(color.r, color.g, color.b);
-            }
-            return rlottie::Color(1.0f, 1.0f, 1.0f);
-          });
+          mVectorRenderer->setValue<rlottie::Property::FillColor>(keyPath, DynamicPropertyGetter<rlottie::Color>(*callback, id, property, mRenderCount, rlottie::Color(1.0f, 1.0f, 1.0f), ConvertToColor));
           break;
         }
         case VectorProperty::FILL_OPACITY:
         {
-          mVectorRenderer->setValue<rlottie::Property::FillOpacity>(keyPath,
-                                                                    [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            float           opacity;
-            if(value.Get(opacity))
-            {
-              return opacity * 100;
-            }
-            return 100.0f;
-          });
+          mVectorRenderer->setValue<rlottie::Property::FillOpacity>(keyPath, DynamicPropertyGetter<float>(*callback, id, property, mRenderCount, 100.0f, ConvertToOpacity));
           break;
         }
         case VectorProperty::STROKE_COLOR:
         {
-          mVectorRenderer->setValue<rlottie::Property::StrokeColor>(keyPath,
-                                                                    [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            Vector3         color;
-            if(value.Get(color))
-            {
-              return rlottie::Color(color.r, color.g, color.b);
-            }
-            return rlottie::Color(1.0f, 1.0f, 1.0f);
-          });
+          mVectorRenderer->setValue<rlottie::Property::StrokeColor>(keyPath, DynamicPropertyGetter<rlottie::Color>(*callback, id, property, mRenderCount, rlottie::Color(1.0f, 1.0f, 1.0f), ConvertToColor));
           break;
         }
         case VectorProperty::STROKE_OPACITY:
         {
-          mVectorRenderer->setValue<rlottie::Property::StrokeOpacity>(keyPath,
-                                                                      [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            float           opacity;
-            if(value.Get(opacity))
-            {
-              return opacity * 100;
-            }
-            return 100.0f;
-          });
+          mVectorRenderer->setValue<rlottie::Property::StrokeOpacity>(keyPath, DynamicPropertyGetter<float>(*callback, id, property, mRenderCount, 100.0f, ConvertToOpacity));
           break;
         }
         case VectorProperty::STROKE_WIDTH:
         {
-          mVectorRenderer->setValue<rlottie::Property::StrokeWidth>(keyPath,
-                                                                    [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            float           width;
-            if(value.Get(width))
-            {
-              return width;
-            }
-            return 1.0f;
-          });
+          mVectorRenderer->setValue<rlottie::Property::StrokeWidth>(keyPath, DynamicPropertyGetter<float>(*callback, id, property, mRenderCount, 1.0f, ConvertToFloat));
           break;
         }
         case VectorProperty::TRANSFORM_ANCHOR:
         {
-          mVectorRenderer->setValue<rlottie::Property::TrAnchor>(keyPath, [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            Vector2         point;
-            if(value.Get(point))
-            {
-              return rlottie::Point(point.x, point.y);
-            }
-            return rlottie::Point(0.0f, 0.0f);
-          });
+          mVectorRenderer->setValue<rlottie::Property::TrAnchor>(keyPath, DynamicPropertyGetter<rlottie::Point>(*callback, id, property, mRenderCount, rlottie::Point(0.0f, 0.0f), ConvertToPoint));
           break;
         }
         case VectorProperty::TRANSFORM_POSITION:
         {
-          mVectorRenderer->setValue<rlottie::Property::TrPosition>(keyPath,
-                                                                   [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            Vector2         position;
-            if(value.Get(position))
-            {
-              return rlottie::Point(position.x, position.y);
-            }
-            return rlottie::Point(0.0f, 0.0f);
-          });
+          mVectorRenderer->setValue<rlottie::Property::TrPosition>(keyPath, DynamicPropertyGetter<rlottie::Point>(*callback, id, property, mRenderCount, rlottie::Point(0.0f, 0.0f), ConvertToPoint));
           break;
         }
         case VectorProperty::TRANSFORM_SCALE:
         {
-          mVectorRenderer->setValue<rlottie::Property::TrScale>(keyPath,
-                                                                [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            Vector2         scale;
-            if(value.Get(scale))
-            {
-              return rlottie::Size(scale.x, scale.y);
-            }
-            return rlottie::Size(100.0f, 100.0f);
-          });
+          mVectorRenderer->setValue<rlottie::Property::TrScale>(keyPath, DynamicPropertyGetter<rlottie::Size>(*callback, id, property, mRenderCount, rlottie::Size(100.0f, 100.0f), ConvertToSize));
           break;
         }
         case VectorProperty::TRANSFORM_ROTATION:
         {
-          mVectorRenderer->setValue<rlottie::Property::TrRotation>(keyPath,
-                                                                   [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            float           rotation;
-            if(value.Get(rotation))
-            {
-              return rotation;
-            }
-            return 0.0f;
-          });
+          mVectorRenderer->setValue<rlottie::Property::TrRotation>(keyPath, DynamicPropertyGetter<float>(*callback, id, property, mRenderCount, 0.0f, ConvertToFloat));
           break;
         }
         case VectorProperty::TRANSFORM_OPACITY:
         {
-          mVectorRenderer->setValue<rlottie::Property::TrOpacity>(keyPath,
-                                                                  [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            float           opacity;
-            if(value.Get(opacity))
-            {
-              return opacity * 100;
-            }
-            return 100.0f;
-          });
+          mVectorRenderer->setValue<rlottie::Property::TrOpacity>(keyPath, DynamicPropertyGetter<float>(*callback, id, property, mRenderCount, 100.0f, ConvertToOpacity));
           break;
         }
         case VectorProperty::TRIM_START:
         {
 #ifdef OVER_TIZEN_VERSION_9
-          mVectorRenderer->setValue<rlottie::Property::TrimStart>(keyPath,
-                                                                  [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            float           start;
-            if(value.Get(start))
-            {
-              return start;
-            }
-            return 0.0f;
-          });
+          mVectorRenderer->setValue<rlottie::Property::TrimStart>(keyPath, DynamicPropertyGetter<float>(*callback, id, property, mRenderCount, 0.0f, ConvertToFloat));
 #endif
           break;
         }
         case VectorProperty::TRIM_END:
         {
 #ifdef OVER_TIZEN_VERSION_9
-          mVectorRenderer->setValue<rlottie::Property::TrimEnd>(keyPath,
-                                                                [property, callback, id](const rlottie::FrameInfo& info)
-          {
-            Property::Value value = CallbackBase::ExecuteReturn<Property::Value>(*callback, id, property, info.curFrame());
-            Vector2         position;
-            if(value.Get(position))
-            {
-              return rlottie::Point(position.x, position.y);
-            }
-            return rlottie::Point(0.0f, 100.0f);
-          });
+          mVectorRenderer->setValue<rlottie::Property::TrimEnd>(keyPath, DynamicPropertyGetter<rlottie::Point>(*callback, id, property, mRenderCount, rlottie::Point(0.0f, 100.0f), ConvertToPoint));
 #endif
           break;
         }
@@ -526,6 +920,7 @@ void VectorAnimationRenderer::RefreshDynamicProperty()
 void VectorAnimationRenderer::KeepRasterizedBuffer()
 {
   Dali::Mutex::ScopedLock lock(mMutex);
+  StopFixedCacheWarmUp();
   mEnableFixedCache = true;
   mDecodedBuffers.clear();
 }
@@ -560,8 +955,7 @@ void VectorAnimationRenderer::NotifyEvent()
       // Set texture
       if(mRenderer && GetTargetTexture())
       {
-        TextureSet textureSet = mRenderer.GetTextures();
-        textureSet.SetTexture(0, GetTargetTexture());
+        SetTargetTexture(mRenderer);
       }
 
       mResourceReadyTriggered = false;
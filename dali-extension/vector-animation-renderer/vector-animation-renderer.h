@@ -23,6 +23,8 @@
 #include <dali/devel-api/adaptor-framework/vector-animation-renderer-plugin.h>
 #include <dali/devel-api/common/vector-wrapper.h>
 #include <dali/devel-api/threading/mutex.h>
+#include <dali/public-api/adaptor-framework/async-task-manager.h>
+#include <dali/public-api/math/vector4.h>
 #include <rlottie.h>
 #include <memory>
 
@@ -143,12 +145,39 @@ protected: // Implementation of VectorAnimationEventHandler
   void NotifyEvent() override;
 
 protected:
+  class PrepareBufferTask;
+  class RenderingDataPool;
+  class WarmUpPool;
+  struct WarmUpState;
+
   class RenderingData
   {
   public:
-    Dali::Texture mTexture;   ///< Texture
-    uint32_t      mWidth{0};  ///< The width of the surface
-    uint32_t      mHeight{0}; ///< The height of the surface
+    virtual ~RenderingData() = default;
+
+    /**
+     * @brief Allocate the buffers which don't need the main thread, e.g. the surfaces to render into.
+     *
+     * It can be called in a worker thread, so it must not use the renderer.
+     */
+    virtual void PrepareBuffer()
+    {
+    }
+
+    /**
+     * @brief Retrieve the memory which is kept if the prepared target is pooled for another renderer.
+     *
+     * @return The size in bytes, or 0 if the target can not be reused.
+     */
+    virtual size_t GetReusableMemorySize() const
+    {
+      return 0u;
+    }
+
+    Dali::Texture mTexture;                      ///< Texture
+    uint32_t      mWidth{0};                     ///< The width of the surface
+    uint32_t      mHeight{0};                    ///< The height of the surface
+    Pixel::Format mFormat{Dali::Pixel::BGRA8888}; ///< The pixel format of the surface
   };
 
   /**
@@ -162,7 +191,7 @@ protected:
   virtual void OnNotify() = 0;
 
   /**
-   * @brief Prepare target
+   * @brief Prepare target whose buffer is prepared. This function is called in the main thread.
    */
   virtual void PrepareTarget(std::shared_ptr<RenderingData> renderingData) = 0;
 
@@ -181,8 +210,24 @@ protected:
    */
   virtual Dali::Texture GetTargetTexture() = 0;
 
+  /**
+   * @brief Retrieve the area of the target texture which has the frame, in texture coordinates.
+   *
+   * @return The area as (x, y, width, height). The whole texture by default.
+   */
+  virtual Vector4 GetTargetTextureRect();
+
+  /**
+   * @brief Set the target texture and its area to the renderer.
+   *
+   * The area is applied through the pixel area of the renderer, combined with the pixel area it had.
+   */
+  void SetTargetTexture(Renderer& renderer);
+
   /**
    * @brief Clear Previous RenderingData
+   *
+   * The reusable ones are returned to the pool shared by all the renderers.
    */
   void ClearPreviousRenderingData();
 
@@ -191,6 +236,54 @@ protected:
    */
   virtual std::shared_ptr<RenderingData> CreateRenderingData() = 0;
 
+  /**
+   * @brief Retrieve the pixel format of the targets, so a pooled target can be found before creating one.
+   *
+   * @return The pixel format. BGRA8888 by default.
+   */
+  virtual Pixel::Format GetTargetFormat() const;
+
+  /**
+   * @brief Called in the main thread when the buffer of the prepared rendering data is allocated by a worker.
+   */
+  void OnBufferPrepared(AsyncTaskPtr task);
+
+  /**
+   * @brief Cancel the allocation of the buffer, if any. This function is called in the main thread.
+   */
+  void CancelPrepareBufferTask();
+
+  /**
+   * @brief Starts rasterizing all the frames for the fixed cache on the worker threads shared by all the renderers.
+   *
+   * The frames are rendered in ranges with separate rlottie animations, so the cache is filled before the playback reaches them.
+   * It is not started when the content is loaded from data or has dynamic properties.
+   * This Method is called inside mMutex.
+   *
+   * @param[in] width The width of a frame
+   * @param[in] height The height of a frame
+   * @param[in] stride The stride of the target buffer in bytes
+   */
+  void StartFixedCacheWarmUp(uint32_t width, uint32_t height, size_t stride);
+
+  /**
+   * @brief Stops rasterizing the frames for the fixed cache and discards the frames not taken yet.
+   *
+   * It doesn't wait for the running jobs, which drop their frames.
+   * This Method is called inside mMutex.
+   */
+  void StopFixedCacheWarmUp();
+
+  /**
+   * @brief Moves the frame rasterized by the warm up to mDecodedBuffers.
+   *
+   * This Method is called inside mMutex.
+   *
+   * @param[in] frameNumber The frame number
+   * @return True if the frame was rasterized, false otherwise.
+   */
+  bool TakeWarmedUpBuffer(uint32_t frameNumber);
+
 protected:
   std::string                                        mUrl;               ///< The content file path
   std::vector<std::unique_ptr<CallbackBase>>         mPropertyCallbacks; ///< Property callback list
@@ -203,7 +296,15 @@ protected:
   mutable Dali::Mutex mMutex;              ///< Mutex. We can lock mRenderingDataMutex under this scope.
   mutable Dali::Mutex mRenderingDataMutex; ///< Mutex. We cannot lock any mutex under this scope.
 
+  std::shared_ptr<WarmUpState> mWarmUpState; ///< The frames rasterized for the fixed cache, null if the warm up is not started
+
+  AsyncTaskPtr mPrepareBufferTask; ///< The task allocating the buffer of the next rendering data. Used in the main thread only.
+
   Dali::Renderer                      mRenderer;                   ///< Renderer
+  Vector4                             mPixelArea;                  ///< The pixel area of the renderer before the target texture area is applied
+  Vector4                             mTargetPixelArea;            ///< The pixel area registered to the renderer, with the target texture area applied
+  Property::Index                     mPixelAreaIndex;             ///< The index of the pixel area if the target texture area is applied
+  uint32_t                            mRenderCount;                ///< Increased before each frame is rendered. The dynamic properties are retrieved once per count.
   std::unique_ptr<rlottie::Animation> mVectorRenderer;             ///< The vector animation renderer
   UploadCompletedSignalType           mUploadCompletedSignal;      ///< Upload completed signal
   uint32_t                            mTotalFrameNumber;           ///< The total frame number
@@ -41,7 +41,7 @@ VideoPlayerBase::VideoPlayerBase(Dali::VideoSyncMode syncMode, Dali::Actor syncA
   mIsLetterBoxEnabled(false),
   mInterpolationInterval(0.0f),
   mUseOffscreenFrameRendering(false),
-  mPacketMutex(),
+  mFrameQueue([this](void* packet) { DestroyMediaPacket(packet); }, [this](void* packet) { return GetSurfaceFromPacket(packet); }),
   mEventCallback(nullptr)
 {
 }
@@ -400,66 +400,23 @@ void VideoPlayerBase::TriggerUiUpdate()
 
 void VideoPlayerBase::PushPacket(void* packet)
 {
-  Dali::Mutex::ScopedLock lock(mPacketMutex);
-  mPacketQueue.push_back(packet);
+  mFrameQueue.Push(packet);
 }
 
 void VideoPlayerBase::ClearPackets()
 {
-  Dali::Mutex::ScopedLock lock(mPacketMutex);
-  for(void* packet : mPacketQueue)
-  {
-    DestroyMediaPacket(packet);
-  }
-  mPacketQueue.clear();
-
-  for(void* packet : mUsedPackets)
-  {
-    DestroyMediaPacket(packet);
-  }
-  mUsedPackets.clear();
+  mFrameQueue.Clear();
 }
 
 void VideoPlayerBase::DoUpdateUi()
 {
-  Dali::Mutex::ScopedLock lock(mPacketMutex);
-
-  if(mPacketQueue.empty())
-  {
-    return;
-  }
-
-  void* nextPacket = mPacketQueue.front();
-  mPacketQueue.pop_front();
-
-  if(!nextPacket)
-  {
-    return;
-  }
-
-  Any surface = GetSurfaceFromPacket(nextPacket);
+  // The presented packet is retained by the queue, to prevent tearing.
+  Any surface = mFrameQueue.Present();
   if(!surface.Empty() && mNativeImagePtr)
   {
     mNativeImagePtr->SetSource(surface);
     Dali::Adaptor::Get().RequestProcessEventsAndUpdate();
   }
-  else if(surface.Empty())
-  {
-    DestroyMediaPacket(nextPacket);
-    return; // Failed to extract surface
-  }
-
-  // Store in used packets to keep it alive (required by Wayland/TBM to prevent tearing)
-  mUsedPackets.push_back(nextPacket);
-
-  // Keep a maximum of 3 used packets
-  const size_t MAX_USED_PACKETS = 3;
-  while(mUsedPackets.size() > MAX_USED_PACKETS)
-  {
-    void* oldPacket = mUsedPackets.front();
-    mUsedPackets.pop_front();
-    DestroyMediaPacket(oldPacket);
-  }
 }
 
 } // namespace Plugin
@@ -32,6 +32,9 @@
 #include <deque>
 #include <functional>
 
+// INTERNAL INCLUDES
+#include "../../integration-api/media-frame-queue.h"
+
 namespace Dali
 {
 namespace Plugin
@@ -335,7 +338,7 @@ public:
   void TriggerUiUpdate();
 
   /**
-   * @brief Pushes a new decoded packet to the queue.
+   * @brief Pushes a new decoded packet to the frame queue.
    * Thread-safe. Called by decoding thread.
    */
   void PushPacket(void* packet);
@@ -352,7 +355,8 @@ protected:
 
   /**
    * @brief Called on the main UI thread when a UI update is triggered.
-   * Subclasses should override this to perform the actual rendering update (e.g., setting native image source).
+   * The default implementation presents a packet of the frame queue to the native image.
+   * Subclasses can override this to perform the actual rendering update (e.g., setting native image source).
    */
   virtual void DoUpdateUi();
 
@@ -537,7 +541,7 @@ protected:
   virtual Any GetSurfaceFromPacket(void* packet) { return Any(); }
 
   /**
-   * @brief Clears all pending and used packets.
+   * @brief Clears all pending and retained packets of the frame queue.
    */
   void ClearPackets();
 
@@ -560,15 +564,12 @@ protected:
   bool                                                mUseOffscreenFrameRendering; ///< Offscreen frame rendering enabled state
   Dali::NativeImagePtr                                mPreviousFrameBuffer;        ///< Previous frame buffer for interpolation
   Dali::NativeImagePtr                                mCurrentFrameBuffer;         ///< Current frame buffer for interpolation
-  Dali::Mutex                                         mPacketMutex;                ///< Mutex for packet operations
+  MediaFrameQueue                                     mFrameQueue;                 ///< Decoded packets, pending and recently displayed
 
   std::queue<Command>                                 mCommandQueue;               ///< Queue for asynchronous command processing
   Dali::Mutex                                         mCommandMutex;               ///< Mutex for command queue
   std::unique_ptr<Dali::EventThreadCallback>          mEventCallback;              ///< Callback for UI thread updates
   Dali::VideoPlayerPlugin::VideoPlayerEventSignalType mEventSignal;             ///< Centralized event signal
-
-  std::deque<void*>                                   mPacketQueue;                ///< Pending decoded packets
-  std::deque<void*>                                   mUsedPackets;                ///< Recently displayed packets (prevent tearing)
 };
 
 } // namespace Plugin
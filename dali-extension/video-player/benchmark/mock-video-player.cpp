@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <mock-video-player.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Dali
+{
+namespace Plugin
+{
+namespace
+{
+/**
+ * @brief A synthetic decoded packet.
+ */
+struct MockPacket
+{
+  uint32_t                           sequence;
+  MockVideoPlayer::Clock::time_point pushTime;
+  std::vector<uint8_t>               data;
+};
+
+double ElapsedMilliseconds(MockVideoPlayer::Clock::time_point start, MockVideoPlayer::Clock::time_point end)
+{
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // unnamed namespace
+
+MockVideoPlayer::MockVideoPlayer()
+: VideoPlayerBase(Dali::VideoSyncMode::DISABLED, Dali::Actor()),
+  mSettings(),
+  mProducer(),
+  mProducerFinished(false),
+  mStopRequested(false),
+  mLatencies(),
+  mPushTimes(),
+  mUpdateTimes(),
+  mExecutedCommandCount(0u),
+  mPlayPosition(0)
+{
+}
+
+MockVideoPlayer::~MockVideoPlayer()
+{
+  // The packets must be destroyed here, while DestroyMediaPacket() is still overridden.
+  Finish();
+}
+
+void MockVideoPlayer::Start(const Settings& settings)
+{
+  Finish();
+
+  mSettings         = settings;
+  mProducerFinished = false;
+  mStopRequested    = false;
+  mLatencies.reserve(settings.frameCount);
+  mPushTimes.reserve(settings.frameCount);
+  mUpdateTimes.reserve(settings.frameCount);
+
+  InitializeUiUpdateCallback();
+  mProducer = std::thread(&MockVideoPlayer::Produce, this);
+}
+
+bool MockVideoPlayer::IsFinished() const
+{
+  return mProducerFinished && !mFrameQueue.HasPendingPackets();
+}
+
+void MockVideoPlayer::Finish()
+{
+  mStopRequested = true;
+  if(mProducer.joinable())
+  {
+    mProducer.join();
+  }
+  ClearPackets();
+}
+
+void MockVideoPlayer::DoUpdateUi()
+{
+  const auto start = Clock::now();
+  VideoPlayerBase::DoUpdateUi();
+
+  if(mSettings.updateCostUs > 0u)
+  {
+    // Busy wait, so the event thread is occupied like the real one.
+    const auto end = start + std::chrono::microseconds(mSettings.updateCostUs);
+    while(Clock::now() < end)
+    {
+    }
+  }
+  mUpdateTimes.push_back(ElapsedMilliseconds(start, Clock::now()));
+}
+
+void MockVideoPlayer::DestroyMediaPacket(void* packet)
+{
+  delete static_cast<MockPacket*>(packet);
+}
+
+Any MockVideoPlayer::GetSurfaceFromPacket(void* packet)
+{
+  // This is called by the frame queue when the packet is presented, so it is the end of the latency.
+  MockPacket* mockPacket = static_cast<MockPacket*>(packet);
+  mLatencies.push_back(ElapsedMilliseconds(mockPacket->pushTime, Clock::now()));
+  return Any(packet);
+}
+
+void MockVideoPlayer::Produce()
+{
+  const auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / std::max(mSettings.frameRate, 1.0f)));
+  auto       deadline = Clock::now();
+
+  for(uint32_t sequence = 0u; sequence < mSettings.frameCount && !mStopRequested; ++sequence)
+  {
+    std::this_thread::sleep_until(deadline);
+    deadline += interval;
+
+    // Writing the whole payload emulates the decoder filling the surface.
+    MockPacket* packet = new MockPacket{sequence, Clock::time_point(), std::vector<uint8_t>(mSettings.packetSize, static_cast<uint8_t>(sequence))};
+
+    const auto pushStart = Clock::now();
+    packet->pushTime     = pushStart;
+    PushPacket(packet);
+    TriggerUiUpdate();
+    mPushTimes.push_back(ElapsedMilliseconds(pushStart, Clock::now()));
+  }
+
+  mProducerFinished = true;
+  TriggerUiUpdate();
+}
+
+} // namespace Plugin
+} // namespace Dali
@@ -0,0 +1,232 @@
+#ifndef DALI_EXTENSION_MOCK_VIDEO_PLAYER_H
+#define DALI_EXTENSION_MOCK_VIDEO_PLAYER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <video-player-base.h>
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Dali
+{
+namespace Plugin
+{
+
+/**
+ * @brief A video player backend which generates synthetic packets, for measuring the VideoPlayerBase frame path.
+ *
+ * A producer thread pushes packets at a fixed rate, like the decoded callback of a media player, and
+ * the packets are presented by VideoPlayerBase::DoUpdateUi() on the event thread. No native image is set,
+ * so it runs without Tizen media packets or tbm surfaces.
+ */
+class MockVideoPlayer : public VideoPlayerBase
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief The settings of the producer.
+   */
+  struct Settings
+  {
+    float    frameRate{60.0f};                    ///< The packets pushed per second
+    size_t   packetSize{1920u * 1080u * 3u / 2u}; ///< The bytes written into each packet, NV12 1080p by default
+    uint32_t frameCount{300u};                    ///< The number of packets to push
+    uint32_t updateCostUs{0u};                    ///< Extra busy time of each DoUpdateUi(), to emulate a loaded event thread
+  };
+
+  /**
+   * @brief Constructor.
+   */
+  MockVideoPlayer();
+
+  /**
+   * @brief Destructor.
+   */
+  ~MockVideoPlayer() override;
+
+  /**
+   * @brief Starts the producer thread. This function is called in the main thread.
+   *
+   * @param[in] settings The settings of the producer
+   */
+  void Start(const Settings& settings);
+
+  /**
+   * @brief Retrieves whether all the packets are pushed and handled by the event thread.
+   */
+  bool IsFinished() const;
+
+  /**
+   * @brief Joins the producer thread and destroys the remaining packets.
+   */
+  void Finish();
+
+  /**
+   * @brief Retrieves the time from each push to its presentation in milliseconds.
+   */
+  const std::vector<double>& GetLatencies() const
+  {
+    return mLatencies;
+  }
+
+  /**
+   * @brief Retrieves the time spent by the producer in PushPacket() in milliseconds. It is valid after Finish().
+   */
+  const std::vector<double>& GetPushTimes() const
+  {
+    return mPushTimes;
+  }
+
+  /**
+   * @brief Retrieves the time spent in VideoPlayerBase::DoUpdateUi() in milliseconds.
+   */
+  const std::vector<double>& GetUpdateTimes() const
+  {
+    return mUpdateTimes;
+  }
+
+  /**
+   * @brief Retrieves the statistics of the frame queue.
+   */
+  MediaFrameQueue::Statistics GetFrameStatistics() const
+  {
+    return mFrameQueue.GetStatistics();
+  }
+
+  /**
+   * @brief Retrieves the number of the commands run by the command queue.
+   */
+  uint32_t GetExecutedCommandCount() const
+  {
+    return mExecutedCommandCount;
+  }
+
+protected:
+  /**
+   * @copydoc Dali::Plugin::VideoPlayerBase::DoUpdateUi()
+   */
+  void DoUpdateUi() override;
+
+  /**
+   * @copydoc Dali::Plugin::VideoPlayerBase::DestroyMediaPacket()
+   */
+  void DestroyMediaPacket(void* packet) override;
+
+  /**
+   * @copydoc Dali::Plugin::VideoPlayerBase::GetSurfaceFromPacket()
+   */
+  Any GetSurfaceFromPacket(void* packet) override;
+
+  // Template Method Pattern: Primitive operations. Each of them only counts the command.
+  void DoInitializePlayer() override
+  {
+  }
+  void DoPlay() override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoPause() override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoStop() override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoSetMute(bool mute) override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoSetVolume(float left, float right) override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoSetLooping(bool looping) override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoSetUrl(const std::string& url) override
+  {
+    ++mExecutedCommandCount;
+  }
+  int DoGetPlayPosition() override
+  {
+    return mPlayPosition;
+  }
+  void DoSetPlayPosition(int millisecond) override
+  {
+    mPlayPosition = millisecond;
+    ++mExecutedCommandCount;
+  }
+  void DoSetDisplayRotation(Dali::VideoPlayerPlugin::DisplayRotation rotation) override
+  {
+    ++mExecutedCommandCount;
+  }
+  Dali::VideoPlayerPlugin::DisplayRotation DoGetDisplayRotation() override
+  {
+    return mDisplayRotation;
+  }
+  void DoSetDisplayArea(DisplayArea area) override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoSetDisplayMode(Dali::VideoPlayerPlugin::DisplayMode::Type mode) override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoSetCodecType(Dali::VideoPlayerPlugin::CodecType type) override
+  {
+    ++mExecutedCommandCount;
+  }
+  void DoInitializeTextureStreamMode(Dali::NativeImagePtr nativeImagePtr) override
+  {
+  }
+  Any DoGetMediaPlayer() override
+  {
+    return Any();
+  }
+
+private:
+  /**
+   * @brief The main function of the producer thread.
+   */
+  void Produce();
+
+private:
+  Settings            mSettings;
+  std::thread         mProducer;
+  std::atomic<bool>   mProducerFinished;
+  std::atomic<bool>   mStopRequested;
+  std::vector<double> mLatencies;   ///< Written in the event thread
+  std::vector<double> mPushTimes;   ///< Written in the producer thread
+  std::vector<double> mUpdateTimes; ///< Written in the event thread
+  uint32_t            mExecutedCommandCount;
+  int                 mPlayPosition;
+};
+
+} // namespace Plugin
+} // namespace Dali
+
+#endif // DALI_EXTENSION_MOCK_VIDEO_PLAYER_H
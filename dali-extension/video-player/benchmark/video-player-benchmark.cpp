@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * Measures the VideoPlayerBase frame path with MockVideoPlayer.
+ *
+ * Usage: video-player-benchmark [--rates=30,60,120,240] [--bytes=3110400] [--frames=300] [--update-cost-us=0]
+ *
+ * For every rate, one JSON object is written to stdout on its own line with the latency from a push to
+ * its presentation, the presented and dropped packets, the time the producer spends in PushPacket(),
+ * which grows with lock contention, the time of DoUpdateUi() and the cost of posting a command.
+ * EventThreadCallback needs DALi's event thread, so this runs as a DALi application and needs a display.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/application.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/signals/connection-tracker.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-extension/benchmark/benchmark-utils.h>
+#include <mock-video-player.h>
+
+namespace
+{
+using namespace Dali::Benchmark;
+
+constexpr uint32_t POLL_INTERVAL_MS = 5u;
+
+struct Options
+{
+  std::vector<uint32_t> rates{30u, 60u, 120u, 240u};
+  uint32_t              packetSize{1920u * 1080u * 3u / 2u};
+  uint32_t              frameCount{300u};
+  uint32_t              updateCostUs{0u};
+};
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+  for(int i = 1; i < argc; ++i)
+  {
+    const char* argument = argv[i];
+    if(const char* rates = GetOptionValue(argument, "--rates"))
+    {
+      if(!ParseUnsignedList(rates, options.rates))
+      {
+        return false;
+      }
+    }
+    else if(const char* bytes = GetOptionValue(argument, "--bytes"))
+    {
+      if(!ParseUnsigned(bytes, options.packetSize))
+      {
+        return false;
+      }
+    }
+    else if(const char* frames = GetOptionValue(argument, "--frames"))
+    {
+      if(!ParseUnsigned(frames, options.frameCount))
+      {
+        return false;
+      }
+    }
+    else if(const char* updateCost = GetOptionValue(argument, "--update-cost-us"))
+    {
+      if(!ParseUnsigned(updateCost, options.updateCostUs, true))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      return false;
+    }
+  }
+  return !options.rates.empty();
+}
+
+class Benchmark : public Dali::ConnectionTracker
+{
+public:
+  Benchmark(Dali::Application& application, Options options)
+  : mApplication(application),
+    mOptions(std::move(options)),
+    mPlayer(),
+    mTimer(),
+    mCommandTimes(),
+    mRateIndex(0u)
+  {
+    application.InitSignal().Connect(this, &Benchmark::OnInit);
+  }
+
+private:
+  void OnInit(Dali::Application& application)
+  {
+    mTimer = Dali::Timer::New(POLL_INTERVAL_MS);
+    mTimer.TickSignal().Connect(this, &Benchmark::OnTick);
+    StartRun();
+    mTimer.Start();
+  }
+
+  void StartRun()
+  {
+    Dali::Plugin::MockVideoPlayer::Settings settings;
+    settings.frameRate    = static_cast<float>(mOptions.rates[mRateIndex]);
+    settings.packetSize   = mOptions.packetSize;
+    settings.frameCount   = mOptions.frameCount;
+    settings.updateCostUs = mOptions.updateCostUs;
+
+    mCommandTimes.clear();
+    mPlayer.reset(new Dali::Plugin::MockVideoPlayer());
+    mPlayer->Start(settings);
+  }
+
+  bool OnTick()
+  {
+    // A command is posted on every tick, so the command queue runs while the packets flow.
+    const auto commandStart = Clock::now();
+    mPlayer->SetPlayPosition(static_cast<int>(mCommandTimes.size()));
+    mCommandTimes.push_back(ElapsedMilliseconds(commandStart));
+
+    if(!mPlayer->IsFinished())
+    {
+      return true;
+    }
+
+    mPlayer->Finish();
+    PrintResult();
+    mPlayer.reset();
+
+    if(++mRateIndex < mOptions.rates.size())
+    {
+      StartRun();
+      return true;
+    }
+
+    mApplication.Quit();
+    return false;
+  }
+
+  void PrintResult()
+  {
+    const auto       frameStatistics = mPlayer->GetFrameStatistics();
+    const Statistics latency         = GetStatistics(mPlayer->GetLatencies());
+    const Statistics push            = GetStatistics(mPlayer->GetPushTimes());
+    const Statistics update          = GetStatistics(mPlayer->GetUpdateTimes());
+    const Statistics command         = GetStatistics(mCommandTimes);
+
+    std::printf("{\"rate\":%u,\"bytes\":%u,\"updateCostUs\":%u,\"pushed\":%u,\"presented\":%u,\"dropped\":%u,"
+                "\"latencyMeanMs\":%.4f,\"latencyMedianMs\":%.4f,\"latencyP95Ms\":%.4f,\"latencyMaxMs\":%.4f,"
+                "\"pushMeanMs\":%.4f,\"pushP95Ms\":%.4f,\"pushMaxMs\":%.4f,"
+                "\"updateMeanMs\":%.4f,\"updateP95Ms\":%.4f,\"updateMaxMs\":%.4f,"
+                "\"commands\":%u,\"commandMeanMs\":%.4f,\"commandMaxMs\":%.4f}\n",
+                mOptions.rates[mRateIndex],
+                mOptions.packetSize,
+                mOptions.updateCostUs,
+                frameStatistics.pushed,
+                frameStatistics.presented,
+                frameStatistics.dropped,
+                latency.mean,
+                latency.median,
+                latency.p95,
+                latency.max,
+                push.mean,
+                push.p95,
+                push.max,
+                update.mean,
+                update.p95,
+                update.max,
+                mPlayer->GetExecutedCommandCount(),
+                command.mean,
+                command.max);
+    std::fflush(stdout);
+  }
+
+private:
+  Dali::Application&                              mApplication;
+  Options                                         mOptions;
+  std::unique_ptr<Dali::Plugin::MockVideoPlayer>  mPlayer;
+  Dali::Timer                                     mTimer;
+  std::vector<double>                             mCommandTimes;
+  size_t                                          mRateIndex;
+};
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+  Options options;
+  if(!ParseOptions(argc, argv, options))
+  {
+    std::fprintf(stderr, "Usage: %s [--rates=30,60,120,240] [--bytes=3110400] [--frames=300] [--update-cost-us=0]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  Dali::Application application = Dali::Application::New(&argc, &argv);
+  Benchmark         benchmark(application, std::move(options));
+  application.MainLoop();
+  return EXIT_SUCCESS;
+}
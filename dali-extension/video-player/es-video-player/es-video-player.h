@@ -336,9 +336,6 @@ private:
 #endif
   Property::Index mVideoShellSizePropertyIndex{Property::INVALID_INDEX}; ///< Registered property index driving VideoShellSyncConstraint
   Constraint      mVideoShellSizePropertyConstraint;                     ///< Constraint that keeps the video shell surface synced to UI frames
-
-  Dali::Mutex                                     mPacketMutex;
-  std::vector<esplusplayer_decoded_video_packet*> mPacketVector;
 };
 
 } // namespace Plugin
@@ -33,6 +33,9 @@
 
 #include <tbm_surface.h>
 
+// INTERNAL INCLUDES
+#include "../../integration-api/web-engine-motion-coalescer.h"
+
 namespace Dali
 {
 class PixelData;
@@ -707,6 +710,11 @@ private:
   bool FeedMouseEvent(const TouchEvent& touch);
   bool FeedTouchEvent(const TouchEvent& touch);
 
+  /**
+   * @brief Feeds the motion coalesced during the last frame to the web view.
+   */
+  void FeedCoalescedMotion(const WebEngineMotionCoalescer::Sample& sample);
+
   /**
    * @brief Destroy and re-create native image.
    */
@@ -721,8 +729,13 @@ private:
   std::unique_ptr<WebEngineBackForwardList>                         mWebEngineBackForwardList;
   std::unique_ptr<WebEngineSettings>                                mWebEngineSettings;
   std::unordered_map<std::string, JavaScriptMessageHandlerCallback> mJavaScriptInjectedCallbacks;
+  std::string                                                       mJavaScriptMessageName; ///< The key of the last message. Reused, so finding a handler doesn't allocate
+  std::unordered_map<uint32_t, JavaScriptMessageHandlerCallback>    mJavaScriptEvaluatedCallbacks; ///< Keyed by the id passed to ewk_view_script_execute
+  uint32_t                                                          mNextJavaScriptEvaluationId;
   Dali::WebEngineUserMediaPermissionRequest*                        mWebUserMediaPermissionRequest;
   Dali::WebEngineDeviceListGet*                                     mDeviceListGet;
+  WebEngineMotionCoalescer                                          mMotionCoalescer;
+  bool                                                              mTouchConsumed; ///< Whether the web view consumed the last touch event fed to it
 
   // callback.
   WebEnginePageLoadCallback                   mLoadStartedCallback;
@@ -755,7 +768,6 @@ private:
   VideoPlayingCallback                        mVideoPlayingCallback;
   GeolocationPermissionCallback               mGeolocationPermissionCallback;
   PlainTextReceivedCallback                   mPlainTextReceivedCallback;
-  JavaScriptMessageHandlerCallback            mJavaScriptEvaluatedCallback;
   JavaScriptEntireMessageHandlerCallback      mJavaScriptEntireMessageReceivedCallback;
   WebEngineWebAuthDisplayQRCallback           mWebAuthDisplayQRCallback;
   WebEngineWebAuthResponseCallback            mWebAuthResponseCallback;
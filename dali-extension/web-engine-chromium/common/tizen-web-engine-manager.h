@@ -28,8 +28,8 @@
 #include <ewk_context.h>
 
 #include <array>
-#include <map>
 #include <memory>
+#include <unordered_map>
 
 namespace Dali
 {
@@ -84,12 +84,12 @@ private:
 
   static constexpr uint8_t ContextTypeCount = static_cast<uint8_t>(ContextType::TYPE_COUNT);
 
-  SlotDelegate<WebEngineManager>                                               mSlotDelegate;
-  std::array<std::unique_ptr<WebEngineContext>, ContextTypeCount>              mWebEngineContexts;
-  std::array<std::unique_ptr<WebEngineCookieManager>, ContextTypeCount>        mWebEngineCookieManagers;
-  std::array<std::map<Evas_Object*, Dali::WebEnginePlugin*>, ContextTypeCount> mWebEngines;
-  Ecore_Evas*                                                                  mWindow;
-  bool                                                                         mWebEngineManagerAvailable;
+  SlotDelegate<WebEngineManager>                                                         mSlotDelegate;
+  std::array<std::unique_ptr<WebEngineContext>, ContextTypeCount>                        mWebEngineContexts;
+  std::array<std::unique_ptr<WebEngineCookieManager>, ContextTypeCount>                  mWebEngineCookieManagers;
+  std::array<std::unordered_map<Evas_Object*, Dali::WebEnginePlugin*>, ContextTypeCount> mWebEngines; ///< Looked up for every JavaScript message
+  Ecore_Evas*                                                                            mWindow;
+  bool                                                                                   mWebEngineManagerAvailable;
 };
 
 } // namespace Plugin
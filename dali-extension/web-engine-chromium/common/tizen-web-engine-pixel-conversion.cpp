@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "tizen-web-engine-pixel-conversion.h"
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Dali
+{
+namespace Plugin
+{
+namespace
+{
+inline uint32_t SwapRedAndBlue(uint32_t pixel)
+{
+  return (pixel & 0xff00ff00u) | ((pixel >> 16) & 0xffu) | ((pixel & 0xffu) << 16);
+}
+
+/**
+ * Converts a row, returning the number of pixels which are left for the scalar loop.
+ */
+inline uint32_t ConvertRowVectorized(const uint8_t*& source, uint8_t*& destination, uint32_t width)
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+  for(; width >= 16u; width -= 16u)
+  {
+    uint8x16x4_t pixels = vld4q_u8(source);
+    uint8x16_t   blue   = pixels.val[0];
+    pixels.val[0]       = pixels.val[2];
+    pixels.val[2]       = blue;
+    vst4q_u8(destination, pixels);
+    source += 64u;
+    destination += 64u;
+  }
+#elif defined(__SSE2__)
+  const __m128i alphaGreenMask = _mm_set1_epi32(static_cast<int>(0xff00ff00u));
+  const __m128i byteMask       = _mm_set1_epi32(0xff);
+  for(; width >= 4u; width -= 4u)
+  {
+    const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+    const __m128i red    = _mm_and_si128(_mm_srli_epi32(pixels, 16), byteMask);
+    const __m128i blue   = _mm_slli_epi32(_mm_and_si128(pixels, byteMask), 16);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_or_si128(_mm_and_si128(pixels, alphaGreenMask), _mm_or_si128(red, blue)));
+    source += 16u;
+    destination += 16u;
+  }
+#endif
+  return width;
+}
+} // unnamed namespace
+
+void ConvertArgb8888ToRgba8888(const uint8_t* source, uint32_t sourceStride, uint8_t* destination, uint32_t width, uint32_t height)
+{
+  for(uint32_t y = 0u; y < height; ++y)
+  {
+    const uint8_t* sourceRow      = source + static_cast<size_t>(y) * sourceStride;
+    uint8_t*       destinationRow = destination + static_cast<size_t>(y) * width * 4u;
+
+    uint32_t remaining = ConvertRowVectorized(sourceRow, destinationRow, width);
+    for(; remaining > 0u; --remaining)
+    {
+      uint32_t pixel;
+      std::memcpy(&pixel, sourceRow, sizeof(pixel));
+      pixel = SwapRedAndBlue(pixel);
+      std::memcpy(destinationRow, &pixel, sizeof(pixel));
+      sourceRow += 4u;
+      destinationRow += 4u;
+    }
+  }
+}
+
+} // namespace Plugin
+} // namespace Dali
@@ -0,0 +1,45 @@
+#ifndef DALI_PLUGIN_TIZEN_WEB_ENGINE_PIXEL_CONVERSION_H
+#define DALI_PLUGIN_TIZEN_WEB_ENGINE_PIXEL_CONVERSION_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+namespace Dali
+{
+namespace Plugin
+{
+/**
+ * @brief Converts an Evas ARGB8888 image into RGBA8888 in a single pass.
+ *
+ * Evas stores each pixel as a native endian 32 bit ARGB word, i.e. B, G, R, A
+ * in memory on little endian targets, so the red and blue bytes are swapped.
+ *
+ * @param[in] source The first row of the source image
+ * @param[in] sourceStride The size of a source row in bytes
+ * @param[out] destination The tightly packed destination buffer of width * height * 4 bytes
+ * @param[in] width The width of the image in pixels
+ * @param[in] height The height of the image in pixels
+ */
+void ConvertArgb8888ToRgba8888(const uint8_t* source, uint32_t sourceStride, uint8_t* destination, uint32_t width, uint32_t height);
+
+} // namespace Plugin
+} // namespace Dali
+
+#endif // DALI_PLUGIN_TIZEN_WEB_ENGINE_PIXEL_CONVERSION_H
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/web-engine/web-engine-request-interceptor.h>
+#include <dali/devel-api/threading/mutex.h>
 
 #include <Evas.h>
 
@@ -39,6 +40,12 @@ namespace Plugin
 /**
  * @brief A class TizenWebEngineRequestInterceptor for intercepting http
  * request.
+ *
+ * The url, the method and the headers are read from the engine on demand, so an interceptor
+ * which is only ignored costs nothing. The engine may release the request once it is ignored
+ * or its response is finished and the engine callback has returned. The getters are invalid
+ * after that, unless the interceptor is detached, i.e. kept by the app beyond the engine callback.
+ * Only then are the url, the method and the headers copied when the request is finished.
  */
 class TizenWebEngineRequestInterceptor final : public Dali::WebEngineRequestInterceptor
 {
@@ -108,6 +115,14 @@ public:
    */
   bool WriteResponseChunk(const int8_t* chunk, uint32_t length) override;
 
+  /**
+   * @brief Marks that the interceptor is kept beyond the engine callback.
+   *
+   * It must be called before the engine callback returns. The request is copied now if it is finished already,
+   * or when it is finished otherwise.
+   */
+  void Detach();
+
 private:
   /**
    * @brief Iterator attributes.
@@ -121,12 +136,44 @@ private:
    */
   static Eina_Bool IterateRequestHeaders(const Eina_Hash* hash, const void* key, void* data, void* fdata);
 
+  /**
+   * @brief Marks the request finished, so the engine may release it. It is copied if the interceptor is detached.
+   * This Method is called inside requestMutex.
+   */
+  void FinishRequest();
+
+  /**
+   * @brief Copies the url, the method and the headers of the request.
+   * This Method is called inside requestMutex.
+   */
+  void CopyRequest();
+
+  /**
+   * @brief Fills requestHeaders from the request once.
+   * This Method is called inside requestMutex.
+   */
+  void LoadHeaders() const;
+
+  /**
+   * @brief Retrieves whether the request may be released, so the copies must be used.
+   * This Method is called inside requestMutex.
+   */
+  bool IsRequestCopied() const
+  {
+    return requestFinished && requestDetached;
+  }
+
 private:
   Ewk_Intercept_Request* ewkRequestInterceptor;
   Evas_Object*           ewkWebView;
-  std::string            requestUrl;
-  std::string            requestMethod;
-  Dali::Property::Map    requestHeaders;
+
+  mutable Dali::Mutex         requestMutex;         ///< The getters may be called in the network thread and in the main thread.
+  mutable Dali::Property::Map requestHeaders;       ///< Filled by the first GetHeaders(), or when a detached request is finished
+  mutable bool                requestHeadersLoaded; ///< Whether requestHeaders is filled
+  bool                        requestFinished;      ///< Whether the request is ignored or responded, so it may be released by the engine
+  bool                        requestDetached;      ///< Whether the interceptor is kept beyond the engine callback
+  std::string                 requestUrl;           ///< Copied when a detached request is finished
+  std::string                 requestMethod;        ///< Copied when a detached request is finished
 };
 
 } // namespace Plugin
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "tizen-web-engine-response-cache.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+namespace Dali
+{
+namespace Plugin
+{
+namespace
+{
+constexpr auto   RESPONSE_CACHE_PACK_ENV    = "DALI_WEB_ENGINE_RESPONSE_CACHE_PACK";
+constexpr auto   RESPONSE_CACHE_SIZE_KB_ENV = "DALI_WEB_ENGINE_RESPONSE_CACHE_SIZE_KB";
+constexpr size_t DEFAULT_CACHE_SIZE_KB      = 16u * 1024u;
+
+/**
+ * @brief Matches the text with the pattern, in which '*' matches any characters.
+ */
+bool MatchWildcard(const char* pattern, const char* text)
+{
+  const char* starPattern = nullptr;
+  const char* starText    = nullptr;
+  while(*text)
+  {
+    if(*pattern == '*')
+    {
+      starPattern = ++pattern;
+      starText    = text;
+    }
+    else if(*pattern == *text)
+    {
+      ++pattern;
+      ++text;
+    }
+    else if(starPattern)
+    {
+      pattern = starPattern;
+      text    = ++starText;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  while(*pattern == '*')
+  {
+    ++pattern;
+  }
+  return *pattern == '\0';
+}
+
+std::string MakeHeaders(const std::string& contentType, size_t contentLength)
+{
+  return "HTTP/1.1 200 OK\r\nContent-Type: " + contentType + "\r\nContent-Length: " + std::to_string(contentLength) + "\r\n\r\n";
+}
+
+bool GetFileSize(const std::string& path, size_t& size)
+{
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if(!file)
+  {
+    return false;
+  }
+  size = static_cast<size_t>(file.tellg());
+  return true;
+}
+
+bool ReadFile(const std::string& path, std::vector<int8_t>& contents)
+{
+  std::ifstream file(path, std::ios::binary);
+  if(!file)
+  {
+    return false;
+  }
+  contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  return !file.bad();
+}
+
+} // unnamed namespace
+
+TizenWebEngineResponseCache& TizenWebEngineResponseCache::Get()
+{
+  static TizenWebEngineResponseCache* cache = []() {
+    const char* sizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(RESPONSE_CACHE_SIZE_KB_ENV);
+    const auto  sizeKb     = sizeString ? std::strtoul(sizeString, nullptr, 10) : DEFAULT_CACHE_SIZE_KB;
+
+    // Leaked on purpose, because it may be used by the network thread until the process exits.
+    auto* responseCache = new TizenWebEngineResponseCache(static_cast<size_t>(sizeKb) * 1024u);
+
+    const char* packPath = Dali::EnvironmentVariable::GetEnvironmentVariable(RESPONSE_CACHE_PACK_ENV);
+    if(packPath)
+    {
+      if(responseCache->LoadPack(packPath))
+      {
+        // The files are read in a worker, so the first context is not blocked by the disk.
+        std::thread(&TizenWebEngineResponseCache::Preload, responseCache).detach();
+      }
+      else
+      {
+        DALI_LOG_ERROR("Failed to load the response cache pack [%s]\n", packPath);
+      }
+    }
+    return responseCache;
+  }();
+  return *cache;
+}
+
+TizenWebEngineResponseCache::TizenWebEngineResponseCache(size_t limitBytes)
+: mMutex(),
+  mRules(),
+  mEntries(),
+  mEntryMap(),
+  mPackEntries(),
+  mPreloadUrls(),
+  mLimitBytes(limitBytes),
+  mUsedBytes(0u)
+{
+}
+
+TizenWebEngineResponseCache::~TizenWebEngineResponseCache()
+{
+}
+
+bool TizenWebEngineResponseCache::IsEnabled() const
+{
+  Dali::Mutex::ScopedLock lock(mMutex);
+  return !mRules.empty();
+}
+
+void TizenWebEngineResponseCache::AddRule(const std::string& pattern)
+{
+  Dali::Mutex::ScopedLock lock(mMutex);
+  mRules.push_back(pattern);
+}
+
+bool TizenWebEngineResponseCache::LoadPack(const std::string& manifestPath)
+{
+  std::ifstream manifest(manifestPath);
+  if(!manifest)
+  {
+    return false;
+  }
+
+  const size_t      separator = manifestPath.find_last_of('/');
+  const std::string baseDir   = (separator == std::string::npos) ? std::string() : manifestPath.substr(0u, separator + 1u);
+
+  std::string line;
+  while(std::getline(manifest, line))
+  {
+    std::istringstream stream(line);
+    std::string        command;
+    if(!(stream >> command) || command[0] == '#')
+    {
+      continue;
+    }
+
+    if(command == "rule")
+    {
+      std::string pattern;
+      if(stream >> pattern)
+      {
+        AddRule(pattern);
+      }
+    }
+    else if(command == "entry")
+    {
+      std::string url, contentType, path;
+      if(stream >> url >> contentType >> path)
+      {
+        Dali::Mutex::ScopedLock lock(mMutex);
+        mPackEntries[url] = PackEntry{contentType, (path[0] == '/') ? path : baseDir + path};
+        mPreloadUrls.push_back(url);
+      }
+    }
+    else
+    {
+      DALI_LOG_ERROR("Unknown command in the response cache pack [%s]\n", line.c_str());
+    }
+  }
+
+  return true;
+}
+
+void TizenWebEngineResponseCache::Preload()
+{
+  std::vector<std::string> preloadUrls;
+  {
+    Dali::Mutex::ScopedLock lock(mMutex);
+    preloadUrls.swap(mPreloadUrls);
+  }
+
+  for(const auto& url : preloadUrls)
+  {
+    PackEntry packEntry;
+    {
+      Dali::Mutex::ScopedLock lock(mMutex);
+      auto                        packIter = mPackEntries.find(url);
+      if(packIter == mPackEntries.end() || !MatchesRule(url) || mEntryMap.find(url) != mEntryMap.end())
+      {
+        continue;
+      }
+      packEntry = packIter->second;
+    }
+
+    // Skips the files which don't fit into the remaining memory, so no preloaded entry is evicted by a later one.
+    size_t fileSize = 0u;
+    if(!GetFileSize(packEntry.path, fileSize) || !HasRoomFor(fileSize + MakeHeaders(packEntry.contentType, fileSize).size()))
+    {
+      continue;
+    }
+
+    ResponsePtr response = ReadResponse(packEntry);
+    if(!response)
+    {
+      continue;
+    }
+
+    Dali::Mutex::ScopedLock lock(mMutex);
+    if(mUsedBytes + response->body.size() + response->headers.size() <= mLimitBytes && mEntryMap.find(url) == mEntryMap.end())
+    {
+      Insert(url, std::move(response));
+    }
+  }
+}
+
+void TizenWebEngineResponseCache::Put(const std::string& url, const std::string& contentType, std::vector<int8_t> body)
+{
+  auto response     = std::make_shared<Response>();
+  response->headers = MakeHeaders(contentType, body.size());
+  response->body    = std::move(body);
+
+  Dali::Mutex::ScopedLock lock(mMutex);
+  Insert(url, std::move(response));
+}
+
+TizenWebEngineResponseCache::ResponsePtr TizenWebEngineResponseCache::Find(const std::string& url)
+{
+  PackEntry packEntry;
+  {
+    Dali::Mutex::ScopedLock lock(mMutex);
+    if(!MatchesRule(url))
+    {
+      return nullptr;
+    }
+
+    auto iter = mEntryMap.find(url);
+    if(iter != mEntryMap.end())
+    {
+      // Moves the entry to the front, without copying it.
+      mEntries.splice(mEntries.begin(), mEntries, iter->second);
+      return iter->second->response;
+    }
+
+    auto packIter = mPackEntries.find(url);
+    if(packIter == mPackEntries.end())
+    {
+      return nullptr;
+    }
+    packEntry = packIter->second;
+  }
+
+  // The file is read outside the lock, so other requests are not blocked by the disk.
+  ResponsePtr response = ReadResponse(packEntry);
+  if(!response)
+  {
+    return nullptr;
+  }
+
+  Dali::Mutex::ScopedLock lock(mMutex);
+  Insert(url, response);
+  return response;
+}
+
+bool TizenWebEngineResponseCache::Serve(Dali::WebEngineRequestInterceptor& interceptor)
+{
+  if(!IsEnabled() || interceptor.GetMethod() != "GET")
+  {
+    return false;
+  }
+
+  ResponsePtr response = Find(interceptor.GetUrl());
+  if(!response)
+  {
+    return false;
+  }
+
+  return interceptor.AddResponse(response->headers, response->body.data(), static_cast<uint32_t>(response->body.size()));
+}
+
+TizenWebEngineResponseCache::ResponsePtr TizenWebEngineResponseCache::ReadResponse(const PackEntry& packEntry)
+{
+  std::vector<int8_t> body;
+  if(!ReadFile(packEntry.path, body))
+  {
+    DALI_LOG_ERROR("Failed to read the response cache file [%s]\n", packEntry.path.c_str());
+    return nullptr;
+  }
+
+  auto response     = std::make_shared<Response>();
+  response->headers = MakeHeaders(packEntry.contentType, body.size());
+  response->body    = std::move(body);
+  return response;
+}
+
+bool TizenWebEngineResponseCache::HasRoomFor(size_t size) const
+{
+  Dali::Mutex::ScopedLock lock(mMutex);
+  return mUsedBytes + size <= mLimitBytes;
+}
+
+// This Method is called inside mMutex
+bool TizenWebEngineResponseCache::MatchesRule(const std::string& url) const
+{
+  for(const auto& rule : mRules)
+  {
+    if(MatchWildcard(rule.c_str(), url.c_str()))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// This Method is called inside mMutex
+void TizenWebEngineResponseCache::Insert(const std::string& url, ResponsePtr response)
+{
+  const size_t size = response->body.size() + response->headers.size();
+  if(size > mLimitBytes)
+  {
+    return;
+  }
+
+  auto iter = mEntryMap.find(url);
+  if(iter != mEntryMap.end())
+  {
+    mUsedBytes -= iter->second->response->body.size() + iter->second->response->headers.size();
+    mEntries.erase(iter->second);
+    mEntryMap.erase(iter);
+  }
+
+  mEntries.push_front(Entry{url, std::move(response)});
+  mEntryMap[url] = mEntries.begin();
+  mUsedBytes += size;
+
+  // A response being served is kept alive by its shared pointer after it is evicted.
+  while(mUsedBytes > mLimitBytes)
+  {
+    const Entry& last = mEntries.back();
+    mUsedBytes -= last.response->body.size() + last.response->headers.size();
+    mEntryMap.erase(last.url);
+    mEntries.pop_back();
+  }
+}
+
+} // namespace Plugin
+} // namespace Dali
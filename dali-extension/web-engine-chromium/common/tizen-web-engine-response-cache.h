@@ -0,0 +1,190 @@
+#ifndef DALI_PLUGIN_TIZEN_WEB_ENGINE_RESPONSE_CACHE_H
+#define DALI_PLUGIN_TIZEN_WEB_ENGINE_RESPONSE_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/web-engine/web-engine-request-interceptor.h>
+#include <dali/devel-api/threading/mutex.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Dali
+{
+namespace Plugin
+{
+/**
+ * @brief A class TizenWebEngineResponseCache for serving intercepted requests from memory.
+ *
+ * Responses are kept in a memory bounded LRU, keyed by the exact url. Only the urls which match
+ * one of the rules are looked up. The cache is filled from a pack, a manifest file which lists
+ * the rules and the files of the responses:
+ *
+ *   # comment
+ *   rule http://localhost:8080/static*
+ *   entry http://localhost:8080/static/app.js text/javascript static/app.js
+ *
+ * An entry is served only if its url matches a rule, and its file path is relative to the manifest.
+ * The entries are preloaded in a worker thread in the order of the manifest, skipping the ones which
+ * don't fit into the remaining memory. An entry not loaded or evicted later is read from its file
+ * when it is requested.
+ *
+ * The cache is configured by the environment variables:
+ * - DALI_WEB_ENGINE_RESPONSE_CACHE_PACK : the path of the manifest. The cache is disabled without it.
+ * - DALI_WEB_ENGINE_RESPONSE_CACHE_SIZE_KB : the memory limit of the responses, 16 MB by default.
+ */
+class TizenWebEngineResponseCache
+{
+public:
+  /**
+   * @brief A cached response.
+   */
+  struct Response
+  {
+    std::string         headers; ///< HTTP/1.1 response headers, ending with an empty line
+    std::vector<int8_t> body;
+  };
+
+  using ResponsePtr = std::shared_ptr<const Response>;
+
+  /**
+   * @brief Retrieves the cache configured by the environment variables.
+   *
+   * @return A reference to the cache.
+   */
+  static TizenWebEngineResponseCache& Get();
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] limitBytes The memory limit of the cached responses
+   */
+  explicit TizenWebEngineResponseCache(size_t limitBytes);
+
+  /**
+   * @brief Destructor.
+   */
+  ~TizenWebEngineResponseCache();
+
+  TizenWebEngineResponseCache(const TizenWebEngineResponseCache&) = delete;
+  TizenWebEngineResponseCache& operator=(const TizenWebEngineResponseCache&) = delete;
+
+  /**
+   * @brief Retrieves whether any rule is added.
+   */
+  bool IsEnabled() const;
+
+  /**
+   * @brief Adds a url pattern. '*' matches any characters.
+   *
+   * @param[in] pattern The url pattern
+   */
+  void AddRule(const std::string& pattern);
+
+  /**
+   * @brief Loads the manifest of a pack. Its entries are read by Preload() or when they are requested.
+   *
+   * @param[in] manifestPath The path of the manifest
+   * @return True if the manifest is read, false otherwise.
+   */
+  bool LoadPack(const std::string& manifestPath);
+
+  /**
+   * @brief Reads the entries of the loaded packs which fit into the remaining memory. It can be called in any thread.
+   */
+  void Preload();
+
+  /**
+   * @brief Stores a response.
+   *
+   * @param[in] url The url of the request
+   * @param[in] contentType The content type of the response
+   * @param[in] body The body of the response
+   */
+  void Put(const std::string& url, const std::string& contentType, std::vector<int8_t> body);
+
+  /**
+   * @brief Finds the response of the url. It can be called in any thread.
+   *
+   * @param[in] url The url of the request
+   * @return The response, or nullptr if the url is not cached.
+   */
+  ResponsePtr Find(const std::string& url);
+
+  /**
+   * @brief Answers the request if its response is cached. It can be called in any thread.
+   *
+   * @param[in] interceptor The intercepted request
+   * @return True if the request is answered, false otherwise.
+   */
+  bool Serve(Dali::WebEngineRequestInterceptor& interceptor);
+
+private:
+  struct Entry
+  {
+    std::string url;
+    ResponsePtr response;
+  };
+
+  struct PackEntry
+  {
+    std::string contentType;
+    std::string path;
+  };
+
+  /**
+   * @brief Reads the response of a pack entry from its file.
+   */
+  static ResponsePtr ReadResponse(const PackEntry& packEntry);
+
+  /**
+   * @brief Retrieves whether a response of the size fits into the remaining memory.
+   */
+  bool HasRoomFor(size_t size) const;
+
+  /**
+   * @brief Retrieves whether the url matches any rule. This Method is called inside mMutex.
+   */
+  bool MatchesRule(const std::string& url) const;
+
+  /**
+   * @brief Inserts the response as the most recent one, and evicts the least recent ones over the limit.
+   * This Method is called inside mMutex.
+   */
+  void Insert(const std::string& url, ResponsePtr response);
+
+private:
+  mutable Dali::Mutex                                         mMutex;       ///< Requests are intercepted in the network thread
+  std::vector<std::string>                                    mRules;
+  std::list<Entry>                                            mEntries;     ///< The most recent one first
+  std::unordered_map<std::string, std::list<Entry>::iterator> mEntryMap;
+  std::unordered_map<std::string, PackEntry>                  mPackEntries; ///< The entries which can be read from the pack
+  std::vector<std::string>                                    mPreloadUrls; ///< The entries to preload, in the order of the manifest
+  size_t                                                      mLimitBytes;
+  size_t                                                      mUsedBytes;
+};
+
+} // namespace Plugin
+} // namespace Dali
+
+#endif // DALI_PLUGIN_TIZEN_WEB_ENGINE_RESPONSE_CACHE_H
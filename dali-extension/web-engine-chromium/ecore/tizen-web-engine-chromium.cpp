@@ -30,6 +30,7 @@
 #include "tizen-web-engine-http-auth-handler.h"
 #include "tizen-web-engine-load-error.h"
 #include "tizen-web-engine-manager.h"
+#include "tizen-web-engine-pixel-conversion.h"
 #include "tizen-web-engine-policy-decision.h"
 #include "tizen-web-engine-settings.h"
 #include "tizen-web-engine-user-media-permission-request.h"
@@ -123,6 +124,9 @@ Ret ExecuteCallbackReturn(Callback callback, std::unique_ptr<Arg> arg)
   return returnVal;
 }
 
+constexpr uint32_t MOTION_SOURCE_MOUSE = 0u;
+constexpr uint32_t MOTION_SOURCE_TOUCH = 1u;
+
 } // Anonymous namespace
 
 TizenWebEngineChromium::TizenWebEngineChromium()
@@ -131,8 +135,14 @@ TizenWebEngineChromium::TizenWebEngineChromium()
   mWidth(0),
   mHeight(0),
   mIsIncognito(false),
+  mJavaScriptInjectedCallbacks(),
+  mJavaScriptMessageName(),
+  mJavaScriptEvaluatedCallbacks(),
+  mNextJavaScriptEvaluationId(0u),
   mWebUserMediaPermissionRequest(nullptr),
-  mDeviceListGet(nullptr)
+  mDeviceListGet(nullptr),
+  mMotionCoalescer([this](const WebEngineMotionCoalescer::Sample& sample) { FeedCoalescedMotion(sample); }),
+  mTouchConsumed(false)
 {
 }
 
@@ -263,6 +273,8 @@ void TizenWebEngineChromium::InitWebView(bool incognito)
 void TizenWebEngineChromium::Destroy()
 {
   mJavaScriptInjectedCallbacks.clear();
+  mJavaScriptEvaluatedCallbacks.clear();
+  mMotionCoalescer.Clear();
 
   if(WebEngineManager::IsAvailable() && mWebView != nullptr)
   {
@@ -449,8 +461,15 @@ void TizenWebEngineChromium::GoBack()
 
 void TizenWebEngineChromium::EvaluateJavaScript(const std::string& script, JavaScriptMessageHandlerCallback resultHandler)
 {
-  mJavaScriptEvaluatedCallback = resultHandler;
-  ewk_view_script_execute(mWebView, script.c_str(), &TizenWebEngineChromium::OnJavaScriptEvaluated, this);
+  // Each script carries its own id, so results of scripts evaluated back to back reach their own handlers.
+  const uint32_t id = ++mNextJavaScriptEvaluationId;
+  mJavaScriptEvaluatedCallbacks[id] = resultHandler;
+  if(!ewk_view_script_execute(mWebView, script.c_str(), &TizenWebEngineChromium::OnJavaScriptEvaluated, reinterpret_cast<void*>(static_cast<uintptr_t>(id))))
+  {
+    DALI_LOG_ERROR("Failed to evaluate javascript.\n");
+    mJavaScriptEvaluatedCallbacks.erase(id);
+    ExecuteCallback(resultHandler, std::string());
+  }
 }
 
 void TizenWebEngineChromium::AddJavaScriptMessageHandler(const std::string& exposedObjectName, JavaScriptMessageHandlerCallback handler)
@@ -643,6 +662,7 @@ bool TizenWebEngineChromium::FeedMouseEvent(const TouchEvent& touch)
     {
       float x = touch.GetScreenPosition(0).x;
       float y = touch.GetScreenPosition(0).y;
+      mMotionCoalescer.Flush();
       ewk_view_feed_mouse_down(mWebView, type, x, y);
       break;
     }
@@ -650,6 +670,7 @@ bool TizenWebEngineChromium::FeedMouseEvent(const TouchEvent& touch)
     {
       float x = touch.GetScreenPosition(0).x;
       float y = touch.GetScreenPosition(0).y;
+      mMotionCoalescer.Flush();
       ewk_view_feed_mouse_up(mWebView, type, x, y);
       break;
     }
@@ -657,7 +678,7 @@ bool TizenWebEngineChromium::FeedMouseEvent(const TouchEvent& touch)
     {
       float x = touch.GetScreenPosition(0).x;
       float y = touch.GetScreenPosition(0).y;
-      ewk_view_feed_mouse_move(mWebView, x, y);
+      mMotionCoalescer.AddMotion(x, y, touch.GetTime(), MOTION_SOURCE_MOUSE);
       break;
     }
     default:
@@ -670,6 +691,15 @@ bool TizenWebEngineChromium::FeedMouseEvent(const TouchEvent& touch)
 
 bool TizenWebEngineChromium::FeedTouchEvent(const TouchEvent& touch)
 {
+  // A single point move is fed once per frame with the latest position.
+  // Its result is not known yet, so the web view is assumed to handle it as it handled the last touch.
+  if(touch.GetPointCount() == 1u && touch.GetState(0) == PointState::MOTION)
+  {
+    mMotionCoalescer.AddMotion(touch.GetScreenPosition(0).x, touch.GetScreenPosition(0).y, touch.GetTime(), MOTION_SOURCE_TOUCH);
+    return mTouchConsumed;
+  }
+  mMotionCoalescer.Flush();
+
   Ewk_Touch_Event_Type   type  = EWK_TOUCH_START;
   Evas_Touch_Point_State state = EVAS_TOUCH_POINT_DOWN;
 
@@ -722,9 +752,35 @@ bool TizenWebEngineChromium::FeedTouchEvent(const TouchEvent& touch)
       break;
     }
   }
+  mTouchConsumed = fed;
   return fed;
 }
 
+void TizenWebEngineChromium::FeedCoalescedMotion(const WebEngineMotionCoalescer::Sample& sample)
+{
+  if(!mWebView)
+  {
+    return;
+  }
+
+  if(sample.source == MOTION_SOURCE_TOUCH)
+  {
+    Eina_List*      pointList = 0;
+    Ewk_Touch_Point point;
+    point.id    = 0;
+    point.x     = sample.x;
+    point.y     = sample.y;
+    point.state = EVAS_TOUCH_POINT_MOVE;
+    pointList      = eina_list_append(pointList, &point);
+    mTouchConsumed = ewk_view_feed_touch_event(mWebView, EWK_TOUCH_MOVE, pointList, 0);
+    eina_list_free(pointList);
+  }
+  else
+  {
+    ewk_view_feed_mouse_move(mWebView, sample.x, sample.y);
+  }
+}
+
 void TizenWebEngineChromium::ResetDaliImageSource()
 {
   mDaliImageSrc = NativeImage::New(0, 0, NativeImage::COLOR_DEPTH_DEFAULT);
@@ -732,6 +788,8 @@ void TizenWebEngineChromium::ResetDaliImageSource()
 
 bool TizenWebEngineChromium::SendKeyEvent(const Dali::KeyEvent& keyEvent)
 {
+  mMotionCoalescer.Flush();
+
   void* evasKeyEvent = 0;
   if(keyEvent.GetState() == Dali::KeyEvent::DOWN)
   {
@@ -782,7 +840,7 @@ bool TizenWebEngineChromium::SendHoverEvent(const Dali::HoverEvent& event)
     {
       float x = event.GetScreenPosition(0).x;
       float y = event.GetScreenPosition(0).y;
-      ewk_view_feed_mouse_move(mWebView, x, y);
+      mMotionCoalescer.AddMotion(x, y, event.GetTime(), MOTION_SOURCE_MOUSE);
       break;
     }
     default:
@@ -799,6 +857,7 @@ bool TizenWebEngineChromium::SendWheelEvent(const Dali::WheelEvent& wheel)
   int       step      = wheel.GetDelta();
   float     x         = wheel.GetPoint().x;
   float     y         = wheel.GetPoint().y;
+  mMotionCoalescer.Flush();
   ewk_view_feed_mouse_wheel(mWebView, direction, step, x, y);
   return false;
 }
@@ -878,6 +937,7 @@ void TizenWebEngineChromium::ActivateAccessibility(bool activated)
 
 void TizenWebEngineChromium::FeedMouseWheel(bool yDirection, int step, int x, int y)
 {
+  mMotionCoalescer.Flush();
   ewk_view_feed_mouse_wheel(mWebView, (Eina_Bool)yDirection, step, x, y);
 }
 
@@ -1159,10 +1219,20 @@ Dali::PixelData TizenWebEngineChromium::ConvertImageColorSpace(Evas_Object* imag
 
   int width = 0, height = 0;
   evas_object_image_size_get(image, &width, &height);
+  if(width <= 0 || height <= 0)
+  {
+    return Dali::PixelData();
+  }
+
+  int stride = evas_object_image_stride_get(image);
+  if(stride < width * 4)
+  {
+    stride = width * 4;
+  }
 
   uint32_t bufferSize      = width * height * 4;
   uint8_t* convertedBuffer = new uint8_t[bufferSize];
-  std::memcpy(convertedBuffer, pixelBuffer, bufferSize);
+  ConvertArgb8888ToRgba8888(pixelBuffer, stride, convertedBuffer, width, height);
 
   return Dali::PixelData::New(convertedBuffer, bufferSize, width, height, Dali::Pixel::Format::RGBA8888, Dali::PixelData::ReleaseFunction::DELETE_ARRAY);
 }
@@ -1474,15 +1544,29 @@ void TizenWebEngineChromium::OnAuthenticationChallenged(Evas_Object*, Ewk_Auth_C
   ExecuteCallback(pThis->mHttpAuthHandlerCallback, std::move(authHandler));
 }
 
-void TizenWebEngineChromium::OnJavaScriptEvaluated(Evas_Object*, const char* result, void* data)
+void TizenWebEngineChromium::OnJavaScriptEvaluated(Evas_Object* o, const char* result, void* data)
 {
-  auto        pThis = static_cast<TizenWebEngineChromium*>(data);
-  std::string jsResult;
-  if(result != nullptr)
+  auto plugin = WebEngineManager::Get().Find(o);
+  if(plugin)
   {
-    jsResult = result;
+    auto pThis          = static_cast<TizenWebEngineChromium*>(plugin);
+    auto targetCallback = pThis->mJavaScriptEvaluatedCallbacks.find(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(data)));
+    if(targetCallback == pThis->mJavaScriptEvaluatedCallbacks.end())
+    {
+      return;
+    }
+
+    // The handler may evaluate another script, which could rehash the map.
+    JavaScriptMessageHandlerCallback resultHandler = std::move(targetCallback->second);
+    pThis->mJavaScriptEvaluatedCallbacks.erase(targetCallback);
+
+    std::string jsResult;
+    if(result != nullptr)
+    {
+      jsResult = result;
+    }
+    ExecuteCallback(resultHandler, jsResult);
   }
-  ExecuteCallback(pThis->mJavaScriptEvaluatedCallback, jsResult);
 }
 
 void TizenWebEngineChromium::OnJavaScriptInjected(Evas_Object* o, Ewk_Script_Message message)
@@ -1490,18 +1574,19 @@ void TizenWebEngineChromium::OnJavaScriptInjected(Evas_Object* o, Ewk_Script_Mes
   auto plugin = WebEngineManager::Get().Find(o);
   if(plugin)
   {
-    auto        pThis = static_cast<TizenWebEngineChromium*>(plugin);
-    std::string resultText;
-    if(message.body != nullptr)
-    {
-      resultText = static_cast<char*>(message.body);
-    }
+    auto pThis = static_cast<TizenWebEngineChromium*>(plugin);
 
-    std::string key            = static_cast<const char*>(message.name);
-    auto        targetCallback = pThis->mJavaScriptInjectedCallbacks.find(key);
+    // The key keeps its capacity between the messages, so it is not allocated for each of them.
+    pThis->mJavaScriptMessageName.assign(static_cast<const char*>(message.name));
+    auto targetCallback = pThis->mJavaScriptInjectedCallbacks.find(pThis->mJavaScriptMessageName);
 
     if(targetCallback != pThis->mJavaScriptInjectedCallbacks.end())
     {
+      std::string resultText;
+      if(message.body != nullptr)
+      {
+        resultText = static_cast<char*>(message.body);
+      }
       ExecuteCallback(targetCallback->second, resultText);
     }
   }
@@ -17,6 +17,7 @@
 
 #include "tizen-web-engine-context.h"
 #include "tizen-web-engine-request-interceptor.h"
+#include "tizen-web-engine-response-cache.h"
 #include "tizen-web-engine-security-origin.h"
 
 #include <ewk_context.h>
@@ -38,6 +39,10 @@ TizenWebEngineContext::TizenWebEngineContext(Ewk_Context* context, bool isIncogn
   mEwkContext(context),
   mIsIncognito(isIncognito)
 {
+  if(TizenWebEngineResponseCache::Get().IsEnabled())
+  {
+    ewk_context_intercept_request_callback_set(mEwkContext, &TizenWebEngineContext::OnRequestIntercepted, this);
+  }
 }
 
 TizenWebEngineContext::~TizenWebEngineContext()
@@ -196,7 +201,7 @@ void TizenWebEngineContext::RegisterMimeOverriddenCallback(Dali::WebEngineContex
 void TizenWebEngineContext::RegisterRequestInterceptedCallback(Dali::WebEngineContext::WebEngineRequestInterceptedCallback callback)
 {
   mWebRequestInterceptedCallback = callback;
-  if(mWebRequestInterceptedCallback)
+  if(mWebRequestInterceptedCallback || TizenWebEngineResponseCache::Get().IsEnabled())
   {
     ewk_context_intercept_request_callback_set(mEwkContext, &TizenWebEngineContext::OnRequestIntercepted, this);
   }
@@ -319,9 +324,31 @@ void TizenWebEngineContext::RequestIntercepted(Dali::WebEngineRequestInterceptor
 
 void TizenWebEngineContext::OnRequestIntercepted(Ewk_Context*, Ewk_Intercept_Request* request, void* userData)
 {
-  TizenWebEngineContext*               pThis          = static_cast<TizenWebEngineContext*>(userData);
-  Dali::WebEngineRequestInterceptorPtr webInterceptor = new TizenWebEngineRequestInterceptor(request);
-  pThis->RequestIntercepted(webInterceptor);
+  TizenWebEngineContext*               pThis            = static_cast<TizenWebEngineContext*>(userData);
+  TizenWebEngineRequestInterceptor*    tizenInterceptor = new TizenWebEngineRequestInterceptor(request);
+  Dali::WebEngineRequestInterceptorPtr webInterceptor(tizenInterceptor);
+
+  // Cached responses are answered here, without reaching the app or the network.
+  if(TizenWebEngineResponseCache::Get().Serve(*webInterceptor))
+  {
+    return;
+  }
+
+  if(pThis->mWebRequestInterceptedCallback)
+  {
+    pThis->RequestIntercepted(webInterceptor);
+
+    // The app kept the interceptor, so it may read the request after the engine releases it.
+    if(webInterceptor->ReferenceCount() > 1)
+    {
+      tizenInterceptor->Detach();
+    }
+  }
+  else
+  {
+    // Intercepted only for the cache, so the request goes to the network.
+    webInterceptor->Ignore();
+  }
 }
 
 void TizenWebEngineContext::OnSecurityOriginsAcquired(Eina_List* origins, void* userData)
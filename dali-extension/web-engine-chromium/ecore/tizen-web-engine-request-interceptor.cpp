@@ -26,27 +26,17 @@ namespace Plugin
 {
 
 TizenWebEngineRequestInterceptor::TizenWebEngineRequestInterceptor(Ewk_Intercept_Request* interceptor)
-: ewkRequestInterceptor(interceptor)
+: ewkRequestInterceptor(interceptor),
+  ewkWebView(nullptr),
+  requestMutex(),
+  requestHeaders(),
+  requestHeadersLoaded(false),
+  requestFinished(false),
+  requestDetached(false),
+  requestUrl(),
+  requestMethod()
 {
   ewkWebView = ewk_intercept_request_view_get(ewkRequestInterceptor);
-
-  const char* url = ewk_intercept_request_url_get(ewkRequestInterceptor);
-  if(url)
-  {
-    requestUrl = std::string(url);
-  }
-
-  const char* method = ewk_intercept_request_http_method_get(ewkRequestInterceptor);
-  if(method)
-  {
-    requestMethod = std::string(method);
-  }
-
-  const Eina_Hash* hash = ewk_intercept_request_headers_get(ewkRequestInterceptor);
-  if(hash)
-  {
-    eina_hash_foreach(hash, &TizenWebEngineRequestInterceptor::IterateRequestHeaders, this);
-  }
 }
 
 TizenWebEngineRequestInterceptor::~TizenWebEngineRequestInterceptor()
@@ -60,21 +50,39 @@ Dali::WebEnginePlugin* TizenWebEngineRequestInterceptor::GetWebEngine() const
 
 std::string TizenWebEngineRequestInterceptor::GetUrl() const
 {
-  return requestUrl;
+  Dali::Mutex::ScopedLock lock(requestMutex);
+  if(IsRequestCopied())
+  {
+    return requestUrl;
+  }
+
+  const char* url = ewk_intercept_request_url_get(ewkRequestInterceptor);
+  return url ? std::string(url) : std::string();
 }
 
 Dali::Property::Map TizenWebEngineRequestInterceptor::GetHeaders() const
 {
+  Dali::Mutex::ScopedLock lock(requestMutex);
+  LoadHeaders();
   return requestHeaders;
 }
 
 std::string TizenWebEngineRequestInterceptor::GetMethod() const
 {
-  return requestMethod;
+  Dali::Mutex::ScopedLock lock(requestMutex);
+  if(IsRequestCopied())
+  {
+    return requestMethod;
+  }
+
+  const char* method = ewk_intercept_request_http_method_get(ewkRequestInterceptor);
+  return method ? std::string(method) : std::string();
 }
 
 bool TizenWebEngineRequestInterceptor::Ignore()
 {
+  Dali::Mutex::ScopedLock lock(requestMutex);
+  FinishRequest();
   return ewk_intercept_request_ignore(ewkRequestInterceptor);
 }
 
@@ -111,25 +119,102 @@ bool TizenWebEngineRequestInterceptor::AddResponseHeaders(const Dali::Property::
 
 bool TizenWebEngineRequestInterceptor::AddResponseBody(const int8_t* body, uint32_t length)
 {
+  Dali::Mutex::ScopedLock lock(requestMutex);
+  FinishRequest();
   return ewk_intercept_request_response_body_set(ewkRequestInterceptor, (const char*)body, length);
 }
 
 bool TizenWebEngineRequestInterceptor::AddResponse(const std::string& headers, const int8_t* body, uint32_t length)
 {
+  Dali::Mutex::ScopedLock lock(requestMutex);
+  FinishRequest();
   return ewk_intercept_request_response_set(ewkRequestInterceptor, headers.c_str(), (const char*)body, length);
 }
 
 bool TizenWebEngineRequestInterceptor::WriteResponseChunk(const int8_t* chunk, uint32_t length)
 {
+  if(!chunk || length == 0)
+  {
+    // An empty chunk finishes the response.
+    Dali::Mutex::ScopedLock lock(requestMutex);
+    FinishRequest();
+  }
   return ewk_intercept_request_response_write_chunk(ewkRequestInterceptor, (const char*)chunk, length);
 }
 
 Eina_Bool TizenWebEngineRequestInterceptor::IterateRequestHeaders(const Eina_Hash*, const void* key, void* data, void* fdata)
 {
-  TizenWebEngineRequestInterceptor* pThis = static_cast<TizenWebEngineRequestInterceptor*>(fdata);
-  pThis->requestHeaders.Insert((const char*)key, (char*)data);
+  Dali::Property::Map* headers = static_cast<Dali::Property::Map*>(fdata);
+  headers->Insert((const char*)key, (char*)data);
   return true;
 }
 
+void TizenWebEngineRequestInterceptor::Detach()
+{
+  Dali::Mutex::ScopedLock lock(requestMutex);
+  if(requestDetached)
+  {
+    return;
+  }
+
+  requestDetached = true;
+  if(requestFinished)
+  {
+    // Finished in the engine callback, which has not returned yet, so the request is still valid.
+    CopyRequest();
+  }
+}
+
+// This Method is called inside requestMutex
+void TizenWebEngineRequestInterceptor::FinishRequest()
+{
+  if(requestFinished)
+  {
+    return;
+  }
+
+  requestFinished = true;
+
+  // Nobody reads the request after the engine callback unless the interceptor is kept.
+  if(requestDetached)
+  {
+    CopyRequest();
+  }
+}
+
+// This Method is called inside requestMutex
+void TizenWebEngineRequestInterceptor::CopyRequest()
+{
+  const char* url = ewk_intercept_request_url_get(ewkRequestInterceptor);
+  if(url)
+  {
+    requestUrl = std::string(url);
+  }
+
+  const char* method = ewk_intercept_request_http_method_get(ewkRequestInterceptor);
+  if(method)
+  {
+    requestMethod = std::string(method);
+  }
+
+  LoadHeaders();
+}
+
+// This Method is called inside requestMutex
+void TizenWebEngineRequestInterceptor::LoadHeaders() const
+{
+  if(requestHeadersLoaded)
+  {
+    return;
+  }
+
+  requestHeadersLoaded  = true;
+  const Eina_Hash* hash = ewk_intercept_request_headers_get(ewkRequestInterceptor);
+  if(hash)
+  {
+    eina_hash_foreach(hash, &TizenWebEngineRequestInterceptor::IterateRequestHeaders, &requestHeaders);
+  }
+}
+
 } // namespace Plugin
 } // namespace Dali
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * Measures ToLweKeyValue on the key events of typing a text.
+ *
+ * Usage: web-engine-lwe-input-benchmark [--rounds=200] [--repeat=20]
+ *
+ * The key events are made as Tizen reports them: printable keys carry their key string, except in the
+ * name only stream, where every key goes through the key name fallback. Editing and navigation keys are
+ * mixed in. For each stream, one JSON object is written to stdout on its own line with the time per key
+ * event over the rounds. No display is needed.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/events/key-event-devel.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-extension/benchmark/benchmark-utils.h>
+#include "web-engine-lwe-input.h"
+
+namespace
+{
+using namespace Dali::Benchmark;
+
+constexpr int SHIFT_MODIFIER = 1;
+
+constexpr const char* TEXT =
+  "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs! "
+  "Call me at 010-1234-5678; it's open 9 to 5, Monday-Friday. Visit example.com/help? ";
+
+struct Options
+{
+  uint32_t rounds{200u};
+  uint32_t repeat{20u};
+};
+
+struct PunctuationKey
+{
+  char        character;
+  const char* keyName;
+  bool        shift;
+};
+
+// The key names of a US keyboard.
+constexpr PunctuationKey PUNCTUATION_KEYS[] = {
+  {' ', "space", false},
+  {',', "comma", false},
+  {'.', "period", false},
+  {'\'', "apostrophe", false},
+  {'-', "minus", false},
+  {';', "semicolon", false},
+  {'/', "slash", false},
+  {'?', "slash", true},
+  {'!', "1", true},
+};
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+  for(int i = 1; i < argc; ++i)
+  {
+    const char* argument = argv[i];
+    if(const char* rounds = GetOptionValue(argument, "--rounds"))
+    {
+      if(!ParseUnsigned(rounds, options.rounds))
+      {
+        return false;
+      }
+    }
+    else if(const char* repeat = GetOptionValue(argument, "--repeat"))
+    {
+      if(!ParseUnsigned(repeat, options.repeat))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+Dali::KeyEvent MakeKeyEvent(const std::string& keyName, const std::string& keyString, int keyModifier)
+{
+  return Dali::DevelKeyEvent::New(keyName, "", keyString, 0, keyModifier, 0lu, Dali::KeyEvent::DOWN, "", "", Dali::Device::Class::KEYBOARD, Dali::Device::Subclass::NONE);
+}
+
+void AddCharacter(char character, bool nameOnly, std::vector<Dali::KeyEvent>& events)
+{
+  const std::string keyString = nameOnly ? std::string() : std::string(1u, character);
+  for(const auto& key : PUNCTUATION_KEYS)
+  {
+    if(key.character == character)
+    {
+      events.push_back(MakeKeyEvent(key.keyName, keyString, key.shift ? SHIFT_MODIFIER : 0));
+      return;
+    }
+  }
+
+  const bool upper = std::isupper(static_cast<unsigned char>(character));
+  events.push_back(MakeKeyEvent(std::string(1u, static_cast<char>(std::tolower(static_cast<unsigned char>(character)))), keyString, upper ? SHIFT_MODIFIER : 0));
+}
+
+std::vector<Dali::KeyEvent> MakeKeyStream(const Options& options, bool nameOnly)
+{
+  std::vector<Dali::KeyEvent> events;
+  const size_t                textLength = std::strlen(TEXT);
+  for(uint32_t i = 0u; i < options.repeat; ++i)
+  {
+    for(size_t index = 0u; index < textLength; ++index)
+    {
+      AddCharacter(TEXT[index], nameOnly, events);
+
+      // Corrections and caret moves, as a user makes them while typing.
+      if(index % 23u == 22u)
+      {
+        events.push_back(MakeKeyEvent("BackSpace", "", 0));
+        AddCharacter(TEXT[index], nameOnly, events);
+      }
+      if(index % 41u == 40u)
+      {
+        events.push_back(MakeKeyEvent("Left", "", 0));
+        events.push_back(MakeKeyEvent("Right", "", 0));
+      }
+    }
+    events.push_back(MakeKeyEvent("Return", "", 0));
+  }
+  return events;
+}
+
+void Run(const char* name, const std::vector<Dali::KeyEvent>& events, const Options& options)
+{
+  // Summed, so the lookups are not optimized away.
+  long checksum = 0;
+
+  std::vector<double> eventTimes;
+  eventTimes.reserve(options.rounds);
+  for(uint32_t round = 0u; round < options.rounds; ++round)
+  {
+    const auto start = Clock::now();
+    for(const auto& event : events)
+    {
+      checksum += static_cast<long>(Dali::Plugin::ToLweKeyValue(event));
+    }
+    eventTimes.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(events.size()));
+  }
+
+  const Statistics statistics = GetStatistics(eventTimes);
+  std::printf("{\"stream\":\"%s\",\"events\":%zu,\"rounds\":%u,\"meanNs\":%.2f,\"medianNs\":%.2f,\"p95Ns\":%.2f,\"maxNs\":%.2f,\"checksum\":%ld}\n",
+              name,
+              events.size(),
+              options.rounds,
+              statistics.mean,
+              statistics.median,
+              statistics.p95,
+              statistics.max,
+              checksum);
+  std::fflush(stdout);
+}
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+  Options options;
+  if(!ParseOptions(argc, argv, options))
+  {
+    std::fprintf(stderr, "Usage: %s [--rounds=200] [--repeat=20]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  Run("typing", MakeKeyStream(options, false), options);
+  Run("nameOnly", MakeKeyStream(options, true), options);
+  return EXIT_SUCCESS;
+}
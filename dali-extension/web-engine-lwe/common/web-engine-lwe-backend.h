@@ -18,8 +18,11 @@
 #ifndef DALI_EXTENSION_WEB_ENGINE_LWE_BACKEND_H
 #define DALI_EXTENSION_WEB_ENGINE_LWE_BACKEND_H
 
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/public-api/adaptor-framework/native-image.h>
+#include <dali/public-api/math/rect.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -69,11 +72,36 @@ public:
 
   virtual void SetFrameRenderedCallback(FrameRenderedCallback callback) = 0;
 
+  /**
+   * Copy an area of the frame shown by the native image into an RGBA8888 pixel
+   * buffer. Called on the event thread; the area is clipped to the frame, and an
+   * empty handle is returned if nothing is shown or the clipped area is empty.
+   */
+  virtual Dali::Devel::PixelBuffer CopyDisplayedFrame(const Dali::Rect<int32_t>& area) = 0;
+
   /**
    * Execute a task on DALi's event thread. Backends whose LWE callbacks already
    * run there may execute it immediately.
    */
   virtual void DispatchToEventThread(Task task) = 0;
+
+protected:
+  /**
+   * Clip an area to a frame of the given size; returns false if nothing is left.
+   */
+  static bool ClipToFrame(Dali::Rect<int32_t>& area, uint32_t frameWidth, uint32_t frameHeight)
+  {
+    const int32_t left   = std::max(area.x, 0);
+    const int32_t top    = std::max(area.y, 0);
+    const int32_t right  = std::min(area.x + area.width, static_cast<int32_t>(frameWidth));
+    const int32_t bottom = std::min(area.y + area.height, static_cast<int32_t>(frameHeight));
+    if(right <= left || bottom <= top)
+    {
+      return false;
+    }
+    area = Dali::Rect<int32_t>(left, top, right - left, bottom - top);
+    return true;
+  }
 };
 
 /**
@@ -19,7 +19,9 @@
 
 #include <dali/public-api/events/key-event.h>
 
-#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <string_view>
 
 namespace Dali
 {
@@ -29,75 +31,95 @@ namespace
 {
 constexpr int SHIFT_MODIFIER = 1;
 
-LWE::KeyValue MapNamedKey(const char* keyName)
+struct NamedKey
 {
-  if(!keyName)
-  {
-    return LWE::KeyValue::UnidentifiedKey;
-  }
+  std::string_view name;
+  LWE::KeyValue    keyValue;
+};
 
-  if(std::strcmp(keyName, "Left") == 0 || std::strcmp(keyName, "KP_Left") == 0)
-  {
-    return LWE::KeyValue::ArrowLeftKey;
-  }
-  if(std::strcmp(keyName, "Right") == 0 || std::strcmp(keyName, "KP_Right") == 0)
-  {
-    return LWE::KeyValue::ArrowRightKey;
-  }
-  if(std::strcmp(keyName, "Up") == 0 || std::strcmp(keyName, "KP_Up") == 0)
-  {
-    return LWE::KeyValue::ArrowUpKey;
-  }
-  if(std::strcmp(keyName, "Down") == 0 || std::strcmp(keyName, "KP_Down") == 0)
-  {
-    return LWE::KeyValue::ArrowDownKey;
-  }
-  if(std::strcmp(keyName, "Return") == 0 || std::strcmp(keyName, "KP_Enter") == 0)
-  {
-    return LWE::KeyValue::EnterKey;
-  }
-  if(std::strcmp(keyName, "BackSpace") == 0)
-  {
-    return LWE::KeyValue::BackspaceKey;
-  }
-  if(std::strcmp(keyName, "Tab") == 0)
-  {
-    return LWE::KeyValue::TabKey;
-  }
-  if(std::strcmp(keyName, "Escape") == 0)
-  {
-    return LWE::KeyValue::EscapeKey;
-  }
-  if(std::strcmp(keyName, "Delete") == 0 || std::strcmp(keyName, "KP_Delete") == 0)
-  {
-    return LWE::KeyValue::DeleteKey;
-  }
-  if(std::strcmp(keyName, "Insert") == 0 || std::strcmp(keyName, "KP_Insert") == 0)
-  {
-    return LWE::KeyValue::InsertKey;
-  }
-  if(std::strcmp(keyName, "Home") == 0 || std::strcmp(keyName, "KP_Home") == 0)
-  {
-    return LWE::KeyValue::HomeKey;
-  }
-  if(std::strcmp(keyName, "End") == 0 || std::strcmp(keyName, "KP_End") == 0)
-  {
-    return LWE::KeyValue::EndKey;
-  }
-  if(std::strcmp(keyName, "Prior") == 0 || std::strcmp(keyName, "KP_Prior") == 0)
-  {
-    return LWE::KeyValue::PageUpKey;
-  }
-  if(std::strcmp(keyName, "Next") == 0 || std::strcmp(keyName, "KP_Next") == 0)
+struct CharacterKey
+{
+  std::string_view name;
+  LWE::KeyValue    keyValue;
+  LWE::KeyValue    shiftedKeyValue;
+};
+
+// Sorted by name, so that a key name is found by binary search.
+constexpr NamedKey NAMED_KEYS[] = {
+  {"BackSpace", LWE::KeyValue::BackspaceKey},
+  {"Delete", LWE::KeyValue::DeleteKey},
+  {"Down", LWE::KeyValue::ArrowDownKey},
+  {"End", LWE::KeyValue::EndKey},
+  {"Escape", LWE::KeyValue::EscapeKey},
+  {"Home", LWE::KeyValue::HomeKey},
+  {"Insert", LWE::KeyValue::InsertKey},
+  {"KP_Delete", LWE::KeyValue::DeleteKey},
+  {"KP_Down", LWE::KeyValue::ArrowDownKey},
+  {"KP_End", LWE::KeyValue::EndKey},
+  {"KP_Enter", LWE::KeyValue::EnterKey},
+  {"KP_Home", LWE::KeyValue::HomeKey},
+  {"KP_Insert", LWE::KeyValue::InsertKey},
+  {"KP_Left", LWE::KeyValue::ArrowLeftKey},
+  {"KP_Next", LWE::KeyValue::PageDownKey},
+  {"KP_Prior", LWE::KeyValue::PageUpKey},
+  {"KP_Right", LWE::KeyValue::ArrowRightKey},
+  {"KP_Up", LWE::KeyValue::ArrowUpKey},
+  {"Left", LWE::KeyValue::ArrowLeftKey},
+  {"Next", LWE::KeyValue::PageDownKey},
+  {"Prior", LWE::KeyValue::PageUpKey},
+  {"Return", LWE::KeyValue::EnterKey},
+  {"Right", LWE::KeyValue::ArrowRightKey},
+  {"Space", LWE::KeyValue::SpaceKey},
+  {"Tab", LWE::KeyValue::TabKey},
+  {"Up", LWE::KeyValue::ArrowUpKey},
+  {"space", LWE::KeyValue::SpaceKey},
+};
+
+// Sorted by name, so that a key name is found by binary search.
+constexpr CharacterKey CHARACTER_KEYS[] = {
+  {"apostrophe", LWE::KeyValue::SingleQuoteMarkKey, LWE::KeyValue::DoubleQuoteMarkKey},
+  {"bracketleft", LWE::KeyValue::LeftSquareBracketKey, LWE::KeyValue::LeftCurlyBracketMarkKey},
+  {"bracketright", LWE::KeyValue::RightSquareBracketKey, LWE::KeyValue::RightCurlyBracketMarkKey},
+  {"comma", LWE::KeyValue::CommaMarkKey, LWE::KeyValue::LessThanMarkKey},
+  {"equal", LWE::KeyValue::EqualitySignKey, LWE::KeyValue::PlusMarkKey},
+  {"minus", LWE::KeyValue::UnderScoreMarkKey, LWE::KeyValue::MinusMarkKey},
+  {"period", LWE::KeyValue::PeriodKey, LWE::KeyValue::GreaterThanSignKey},
+  {"semicolon", LWE::KeyValue::SemiColonMarkKey, LWE::KeyValue::ColonMarkKey},
+  {"slash", LWE::KeyValue::SlashKey, LWE::KeyValue::QuestionMarkKey},
+};
+
+template<typename Entry, std::size_t N>
+constexpr bool IsSortedByName(const Entry (&table)[N])
+{
+  for(std::size_t i = 1u; i < N; ++i)
   {
-    return LWE::KeyValue::PageDownKey;
+    if(!(table[i - 1u].name < table[i].name))
+    {
+      return false;
+    }
   }
-  if(std::strcmp(keyName, "space") == 0 || std::strcmp(keyName, "Space") == 0)
+  return true;
+}
+
+static_assert(IsSortedByName(NAMED_KEYS), "NAMED_KEYS must be sorted by name");
+static_assert(IsSortedByName(CHARACTER_KEYS), "CHARACTER_KEYS must be sorted by name");
+
+template<typename Entry, std::size_t N>
+const Entry* FindKey(const Entry (&table)[N], std::string_view name)
+{
+  const Entry* entry = std::lower_bound(std::begin(table), std::end(table), name, [](const Entry& lhs, std::string_view rhs) { return lhs.name < rhs; });
+  return (entry != std::end(table) && entry->name == name) ? entry : nullptr;
+}
+
+LWE::KeyValue MapNamedKey(const char* keyName)
+{
+  if(!keyName)
   {
-    return LWE::KeyValue::SpaceKey;
+    return LWE::KeyValue::UnidentifiedKey;
   }
 
-  return LWE::KeyValue::UnidentifiedKey;
+  const NamedKey* namedKey = FindKey(NAMED_KEYS, keyName);
+  return namedKey ? namedKey->keyValue : LWE::KeyValue::UnidentifiedKey;
 }
 
 LWE::KeyValue MapCharacterKey(const char* keyName, bool isShiftPressed)
@@ -107,77 +129,47 @@ LWE::KeyValue MapCharacterKey(const char* keyName, bool isShiftPressed)
     return LWE::KeyValue::UnidentifiedKey;
   }
 
-  if(std::strcmp(keyName, "minus") == 0)
-  {
-    return isShiftPressed ? LWE::KeyValue::MinusMarkKey : LWE::KeyValue::UnderScoreMarkKey;
-  }
-  if(std::strcmp(keyName, "equal") == 0)
-  {
-    return isShiftPressed ? LWE::KeyValue::PlusMarkKey : LWE::KeyValue::EqualitySignKey;
-  }
-  if(std::strcmp(keyName, "bracketleft") == 0)
+  if(keyName[0] != '\0' && keyName[1] != '\0')
   {
-    return isShiftPressed ? LWE::KeyValue::LeftCurlyBracketMarkKey : LWE::KeyValue::LeftSquareBracketKey;
-  }
-  if(std::strcmp(keyName, "bracketright") == 0)
-  {
-    return isShiftPressed ? LWE::KeyValue::RightCurlyBracketMarkKey : LWE::KeyValue::RightSquareBracketKey;
-  }
-  if(std::strcmp(keyName, "semicolon") == 0)
-  {
-    return isShiftPressed ? LWE::KeyValue::ColonMarkKey : LWE::KeyValue::SemiColonMarkKey;
-  }
-  if(std::strcmp(keyName, "apostrophe") == 0)
-  {
-    return isShiftPressed ? LWE::KeyValue::DoubleQuoteMarkKey : LWE::KeyValue::SingleQuoteMarkKey;
-  }
-  if(std::strcmp(keyName, "comma") == 0)
-  {
-    return isShiftPressed ? LWE::KeyValue::LessThanMarkKey : LWE::KeyValue::CommaMarkKey;
-  }
-  if(std::strcmp(keyName, "period") == 0)
-  {
-    return isShiftPressed ? LWE::KeyValue::GreaterThanSignKey : LWE::KeyValue::PeriodKey;
-  }
-  if(std::strcmp(keyName, "slash") == 0)
-  {
-    return isShiftPressed ? LWE::KeyValue::QuestionMarkKey : LWE::KeyValue::SlashKey;
+    const CharacterKey* characterKey = FindKey(CHARACTER_KEYS, keyName);
+    if(characterKey)
+    {
+      return isShiftPressed ? characterKey->shiftedKeyValue : characterKey->keyValue;
+    }
+    return LWE::KeyValue::UnidentifiedKey;
   }
 
-  if(std::strlen(keyName) == 1u)
+  const char character = keyName[0];
+  if(character >= '0' && character <= '9')
   {
-    const char character = keyName[0];
-    if(character >= '0' && character <= '9')
+    if(isShiftPressed)
     {
-      if(isShiftPressed)
-      {
-        constexpr LWE::KeyValue shiftedDigits[] = {
-          LWE::KeyValue::RightParenthesisMarkKey,
-          LWE::KeyValue::ExclamationMarkKey,
-          LWE::KeyValue::AtMarkKey,
-          LWE::KeyValue::SharpMarkKey,
-          LWE::KeyValue::DollarMarkKey,
-          LWE::KeyValue::PercentMarkKey,
-          LWE::KeyValue::CaretMarkKey,
-          LWE::KeyValue::AmpersandMarkKey,
-          LWE::KeyValue::AsteriskMarkKey,
-          LWE::KeyValue::LeftParenthesisMarkKey,
-        };
-        return shiftedDigits[character - '0'];
-      }
-      return static_cast<LWE::KeyValue>(static_cast<int>(LWE::KeyValue::Digit0Key) + character - '0');
+      constexpr LWE::KeyValue shiftedDigits[] = {
+        LWE::KeyValue::RightParenthesisMarkKey,
+        LWE::KeyValue::ExclamationMarkKey,
+        LWE::KeyValue::AtMarkKey,
+        LWE::KeyValue::SharpMarkKey,
+        LWE::KeyValue::DollarMarkKey,
+        LWE::KeyValue::PercentMarkKey,
+        LWE::KeyValue::CaretMarkKey,
+        LWE::KeyValue::AmpersandMarkKey,
+        LWE::KeyValue::AsteriskMarkKey,
+        LWE::KeyValue::LeftParenthesisMarkKey,
+      };
+      return shiftedDigits[character - '0'];
     }
+    return static_cast<LWE::KeyValue>(static_cast<int>(LWE::KeyValue::Digit0Key) + character - '0');
+  }
 
-    if(character >= 'a' && character <= 'z')
+  if(character >= 'a' && character <= 'z')
+  {
+    int keyValue = static_cast<int>(LWE::KeyValue::LowerAKey) + character - 'a';
+    if(isShiftPressed)
     {
-      int keyValue = static_cast<int>(LWE::KeyValue::LowerAKey) + character - 'a';
-      if(isShiftPressed)
-      {
-        keyValue -= ('z' - 'a');
-        keyValue -= 7;
-      }
-      return static_cast<LWE::KeyValue>(keyValue);
+      keyValue -= ('z' - 'a');
+      keyValue -= 7;
     }
+    return static_cast<LWE::KeyValue>(keyValue);
   }
 
   return LWE::KeyValue::UnidentifiedKey;
@@ -30,7 +30,11 @@
 #include <dali/public-api/events/touch-event.h>
 #include <dali/public-api/events/wheel-event.h>
 #include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/signals/callback.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 namespace Dali
@@ -288,6 +292,66 @@ void ExecuteCallback(const Callback& callback, Args&&... args)
     callback(std::forward<Args>(args)...);
   }
 }
+
+constexpr uint32_t MOTION_SOURCE_TOUCH = 0u;
+constexpr uint32_t MOTION_SOURCE_HOVER = 1u;
+
+uint16_t ScaleScreenshotLength(uint32_t length, float scaleFactor)
+{
+  const float scaledLength = std::round(static_cast<float>(length) * scaleFactor);
+  return static_cast<uint16_t>(std::clamp(scaledLength, 1.0f, static_cast<float>(std::numeric_limits<uint16_t>::max())));
+}
+
+Dali::PixelData CreateScreenshot(Dali::Devel::PixelBuffer& pixelBuffer, float scaleFactor)
+{
+  if(scaleFactor > 0.0f && scaleFactor != 1.0f)
+  {
+    pixelBuffer.Resize(ScaleScreenshotLength(pixelBuffer.GetWidth(), scaleFactor),
+                       ScaleScreenshotLength(pixelBuffer.GetHeight(), scaleFactor));
+  }
+  return Dali::Devel::PixelBuffer::Convert(pixelBuffer);
+}
+
+/**
+ * Scales a copied frame and converts it to PixelData on a worker thread.
+ */
+class ScreenshotTask : public Dali::AsyncTask
+{
+public:
+  ScreenshotTask(Dali::Devel::PixelBuffer                          pixelBuffer,
+                 float                                             scaleFactor,
+                 Dali::WebEnginePlugin::ScreenshotCapturedCallback callback,
+                 Dali::CallbackBase*                               completedCallback)
+  : Dali::AsyncTask(completedCallback),
+    mPixelBuffer(std::move(pixelBuffer)),
+    mScaleFactor(scaleFactor),
+    mCallback(std::move(callback)),
+    mPixelData()
+  {
+  }
+
+  void Process() override
+  {
+    mPixelData = CreateScreenshot(mPixelBuffer, mScaleFactor);
+    mPixelBuffer.Reset();
+  }
+
+  bool IsReady() override
+  {
+    return true;
+  }
+
+  void NotifyCaptured()
+  {
+    ExecuteCallback(mCallback, mPixelData);
+  }
+
+private:
+  Dali::Devel::PixelBuffer                          mPixelBuffer;
+  float                                             mScaleFactor;
+  Dali::WebEnginePlugin::ScreenshotCapturedCallback mCallback;
+  Dali::PixelData                                   mPixelData;
+};
 } // unnamed namespace
 
 std::mutex              WebEngineLwe::sLiveInstancesMutex;
@@ -301,7 +365,14 @@ WebEngineLwe::WebEngineLwe(std::unique_ptr<WebEngineLweBackend> backend)
   mKeyEventsEnabled(true),
   mMouseLeftButtonDown(false),
   mCanGoBack(false),
-  mCanGoForward(false)
+  mCanGoForward(false),
+  mMotionCoalescer([this](const WebEngineMotionCoalescer::Sample& sample)
+  {
+    if(mWebContainer)
+    {
+      DispatchMouseMoveEvent(sample.x, sample.y);
+    }
+  })
 {
   DALI_ASSERT_ALWAYS(mBackend && "LWE platform backend is missing");
 }
@@ -361,6 +432,18 @@ void WebEngineLwe::Destroy()
     sLiveInstances.erase(this);
   }
 
+  mMotionCoalescer.Clear();
+  if(!mScreenshotTasks.empty())
+  {
+    if(Dali::AsyncTaskManager asyncTaskManager = Dali::AsyncTaskManager::Get())
+    {
+      for(auto& task : mScreenshotTasks)
+      {
+        asyncTaskManager.RemoveTask(task);
+      }
+    }
+    mScreenshotTasks.clear();
+  }
   mBackend->SetFrameRenderedCallback({});
   mWebEngineSettings.reset();
   mWebContainer = nullptr;
@@ -838,15 +921,17 @@ bool WebEngineLwe::SendTouchEvent(const Dali::TouchEvent& touch)
   switch(touch.GetState(0u))
   {
     case Dali::PointState::DOWN:
+      mMotionCoalescer.Flush();
       DispatchMouseDownEvent(position.x, position.y);
       break;
     case Dali::PointState::UP:
     case Dali::PointState::LEAVE:
     case Dali::PointState::INTERRUPTED:
+      mMotionCoalescer.Flush();
       DispatchMouseUpEvent(position.x, position.y);
       break;
     case Dali::PointState::MOTION:
-      DispatchMouseMoveEvent(position.x, position.y);
+      mMotionCoalescer.AddMotion(position.x, position.y, touch.GetTime(), MOTION_SOURCE_TOUCH);
       break;
     default:
       break;
@@ -861,6 +946,8 @@ bool WebEngineLwe::SendKeyEvent(const Dali::KeyEvent& event)
     return false;
   }
 
+  mMotionCoalescer.Flush();
+
   const LWE::KeyValue keyValue = ToLweKeyValue(event);
   if(event.GetState() == Dali::KeyEvent::DOWN)
   {
@@ -973,14 +1060,53 @@ void WebEngineLwe::AddDynamicCertificatePath(const std::string&, const std::stri
 {
 }
 
-Dali::PixelData WebEngineLwe::GetScreenshot(Dali::BoundsInteger, float)
+Dali::PixelData WebEngineLwe::GetScreenshot(Dali::BoundsInteger viewArea, float scaleFactor)
 {
-  return {};
+  if(!mWebContainer)
+  {
+    return {};
+  }
+
+  auto pixelBuffer = mBackend->CopyDisplayedFrame(Dali::Rect<int32_t>(viewArea.x, viewArea.y, viewArea.width, viewArea.height));
+  if(!pixelBuffer)
+  {
+    return {};
+  }
+  return CreateScreenshot(pixelBuffer, scaleFactor);
 }
 
-bool WebEngineLwe::GetScreenshotAsynchronously(Dali::BoundsInteger, float, ScreenshotCapturedCallback)
+bool WebEngineLwe::GetScreenshotAsynchronously(Dali::BoundsInteger viewArea, float scaleFactor, ScreenshotCapturedCallback callback)
 {
-  return false;
+  if(!mWebContainer || !callback)
+  {
+    return false;
+  }
+
+  // Only the copy of the shown frame is done here; scaling runs on a worker thread.
+  auto pixelBuffer = mBackend->CopyDisplayedFrame(Dali::Rect<int32_t>(viewArea.x, viewArea.y, viewArea.width, viewArea.height));
+  if(!pixelBuffer)
+  {
+    return false;
+  }
+
+  Dali::AsyncTaskPtr task = new ScreenshotTask(std::move(pixelBuffer),
+                                               scaleFactor,
+                                               std::move(callback),
+                                               Dali::MakeCallback(this, &WebEngineLwe::OnScreenshotCaptured));
+  mScreenshotTasks.push_back(task);
+  Dali::AsyncTaskManager::Get().AddTask(task);
+  return true;
+}
+
+void WebEngineLwe::OnScreenshotCaptured(Dali::AsyncTaskPtr task)
+{
+  auto iter = std::find(mScreenshotTasks.begin(), mScreenshotTasks.end(), task);
+  if(iter == mScreenshotTasks.end())
+  {
+    return;
+  }
+  mScreenshotTasks.erase(iter);
+  static_cast<ScreenshotTask*>(task.Get())->NotifyCaptured();
 }
 
 bool WebEngineLwe::CheckVideoPlayingAsynchronously(VideoPlayingCallback)
@@ -1012,7 +1138,7 @@ bool WebEngineLwe::SendHoverEvent(const Dali::HoverEvent& event)
   if(event.GetState(0u) == Dali::PointState::MOTION)
   {
     const Dali::Vector2& position = event.GetScreenPosition(0u);
-    DispatchMouseMoveEvent(position.x, position.y);
+    mMotionCoalescer.AddMotion(position.x, position.y, event.GetTime(), MOTION_SOURCE_HOVER);
   }
   return false;
 }
@@ -1025,6 +1151,7 @@ bool WebEngineLwe::SendWheelEvent(const Dali::WheelEvent& event)
   }
 
   DALI_ASSERT_ALWAYS(mWebContainer);
+  mMotionCoalescer.Flush();
   const Dali::Vector2& point = event.GetPoint();
   mWebContainer->DispatchMouseWheelEvent(point.x, point.y, event.GetDelta());
   return false;
@@ -1166,6 +1293,7 @@ void WebEngineLwe::RegisterDeviceListGetCallback(WebEngineDeviceListGetCallback)
 void WebEngineLwe::FeedMouseWheel(bool yDirection, int step, int x, int y)
 {
   DALI_ASSERT_ALWAYS(mWebContainer);
+  mMotionCoalescer.Flush();
   mWebContainer->DispatchMouseWheelEvent(x, y, yDirection ? step : -step);
 }
 
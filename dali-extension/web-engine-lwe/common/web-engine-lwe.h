@@ -19,13 +19,16 @@
 #define DALI_EXTENSION_WEB_ENGINE_LWE_H
 
 #include "web-engine-lwe-backend.h"
+#include "../../integration-api/web-engine-motion-coalescer.h"
 
 #include <dali/devel-api/adaptor-framework/web-engine/web-engine-plugin.h>
+#include <dali/public-api/adaptor-framework/async-task-manager.h>
 
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace Dali
 {
@@ -180,6 +183,8 @@ private:
   void DispatchMouseUpEvent(float x, float y);
   void DispatchMouseMoveEvent(float x, float y);
 
+  void OnScreenshotCaptured(Dali::AsyncTaskPtr task);
+
 private:
   static std::mutex              sLiveInstancesMutex;
   static std::set<WebEngineLwe*> sLiveInstances;
@@ -196,6 +201,10 @@ private:
   bool        mCanGoBack;
   bool        mCanGoForward;
 
+  WebEngineMotionCoalescer mMotionCoalescer; ///< Dispatches the latest mouse move once per frame
+
+  std::vector<Dali::AsyncTaskPtr> mScreenshotTasks;
+
   WebEngineFrameRenderedCallback mFrameRenderedCallback;
   WebEnginePageLoadCallback      mLoadStartedCallback;
   WebEnginePageLoadCallback      mLoadFinishedCallback;
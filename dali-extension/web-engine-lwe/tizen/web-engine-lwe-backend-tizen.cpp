@@ -20,18 +20,21 @@
 #include <LWEWebView.h>
 
 #include <dali/devel-api/adaptor-framework/application-devel.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/adaptor-framework/native-image.h>
 #include <dali/public-api/object/any.h>
 #include <dali/public-api/signals/callback.h>
 
+#include <poll.h>
 #include <tbm_dummy_display.h>
 #include <tbm_surface_internal.h>
 #include <unistd.h>
 #include <vconf/vconf.h>
 
 #include <algorithm>
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <utility>
@@ -42,34 +45,140 @@ namespace Plugin
 {
 namespace
 {
+constexpr uint32_t BYTES_PER_PIXEL = 4u;
+
 #ifndef OVER_TIZEN_VERSION_9
 #define DB_NAME_LOCAL_STORAGE "LWE_localStorage.db"
 #define DB_NAME_COOKIES "LWE_Cookies.db"
 #define DB_NAME_CACHE "LWE_Cache.db"
 
-class MutexLocker
+// With three buffers, one surface is displayed, one is rendered by LWE and one may wait for the event thread.
+// With two, a frame waiting for the event thread is dropped when LWE needs a surface.
+constexpr uint32_t DEFAULT_OUTPUT_BUFFER_COUNT = 3u;
+constexpr uint32_t MIN_OUTPUT_BUFFER_COUNT     = 2u;
+constexpr uint32_t MAX_OUTPUT_BUFFER_COUNT     = 3u;
+constexpr auto     OUTPUT_BUFFER_COUNT_ENV     = "DALI_WEB_ENGINE_LWE_OUTPUT_BUFFER_COUNT";
+
+// A superseded surface may still be sampled by the render thread, so it goes back to LWE one frame later.
+constexpr uint32_t RETAINED_OUTPUT_SURFACE_COUNT = 1u;
+
+constexpr unsigned long OUTPUT_SURFACE_DATA_KEY = 0x4c574531u;
+
+/**
+ * State of a surface of the output queue, kept as tbm user data.
+ * Written by the LWE thread before the surface is enqueued.
+ */
+struct OutputSurfaceData
+{
+  uint32_t frameNumber{0u}; // Frame held by the surface, zero if none was rendered
+};
+
+uint32_t GetOutputBufferCount()
 {
-public:
-  explicit MutexLocker(pthread_mutex_t& mutex)
-  : mMutex(mutex)
+  const char* countString = Dali::EnvironmentVariable::GetEnvironmentVariable(OUTPUT_BUFFER_COUNT_ENV);
+  const auto  count       = countString ? std::strtoul(countString, nullptr, 10) : 0u;
+  return (count >= MIN_OUTPUT_BUFFER_COUNT && count <= MAX_OUTPUT_BUFFER_COUNT) ? static_cast<uint32_t>(count) : DEFAULT_OUTPUT_BUFFER_COUNT;
+}
+
+OutputSurfaceData* FindOutputSurfaceData(tbm_surface_h surface)
+{
+  void* data = nullptr;
+  if(!tbm_surface_internal_get_user_data(surface, OUTPUT_SURFACE_DATA_KEY, &data))
   {
-    pthread_mutex_lock(&mMutex);
+    return nullptr;
   }
+  return static_cast<OutputSurfaceData*>(data);
+}
 
-  ~MutexLocker()
+OutputSurfaceData* GetOutputSurfaceData(tbm_surface_h surface)
+{
+  if(auto* data = FindOutputSurfaceData(surface))
   {
-    pthread_mutex_unlock(&mMutex);
+    return data;
   }
 
-private:
-  pthread_mutex_t& mMutex;
-};
+  auto* data = new OutputSurfaceData();
+  tbm_surface_internal_add_user_data(surface, OUTPUT_SURFACE_DATA_KEY, [](void* userData)
+  {
+    delete static_cast<OutputSurfaceData*>(userData);
+  });
+  tbm_surface_internal_set_user_data(surface, OUTPUT_SURFACE_DATA_KEY, data);
+  return data;
+}
+
+void MergeArea(Dali::Rect<int32_t>& area, const Dali::Rect<int32_t>& other)
+{
+  if(other.IsEmpty())
+  {
+    return;
+  }
+  if(area.IsEmpty())
+  {
+    area = other;
+    return;
+  }
+
+  const int32_t left   = std::min(area.x, other.x);
+  const int32_t top    = std::min(area.y, other.y);
+  const int32_t right  = std::max(area.x + area.width, other.x + other.width);
+  const int32_t bottom = std::max(area.y + area.height, other.y + other.height);
+  area                 = Dali::Rect<int32_t>(left, top, right - left, bottom - top);
+}
+
+void CopyArea(const tbm_surface_info_s& source, const tbm_surface_info_s& destination, const Dali::Rect<int32_t>& area)
+{
+  const size_t offset    = static_cast<size_t>(area.x) * BYTES_PER_PIXEL;
+  const size_t rowLength = static_cast<size_t>(area.width) * BYTES_PER_PIXEL;
+  for(int32_t y = area.y; y < area.y + area.height; ++y)
+  {
+    std::memcpy(destination.planes[0].ptr + y * destination.planes[0].stride + offset,
+                source.planes[0].ptr + y * source.planes[0].stride + offset,
+                rowLength);
+  }
+}
 #endif
 
-constexpr int               TBM_SURFACE_QUEUE_LENGTH = 3;
-PFNEGLCREATESYNCKHRPROC     gEglCreateSyncKHR         = nullptr;
-PFNEGLDESTROYSYNCKHRPROC    gEglDestroySyncKHR        = nullptr;
-PFNEGLCLIENTWAITSYNCKHRPROC gEglClientWaitSyncKHR     = nullptr;
+/**
+ * Copies an area of a mapped surface into tightly packed RGBA8888 pixels.
+ * Returns false if the format of the surface is not one used by this backend.
+ */
+bool CopyAreaAsRgba(const tbm_surface_info_s& source, const Dali::Rect<int32_t>& area, uint8_t* destination)
+{
+  // Byte offsets of red, green, blue and alpha in memory; tbm formats name a little endian word.
+  std::array<uint32_t, 4> channelOffsets;
+  switch(source.format)
+  {
+    case TBM_FORMAT_ARGB8888:
+      channelOffsets = {2u, 1u, 0u, 3u};
+      break;
+    case TBM_FORMAT_BGRA8888:
+      channelOffsets = {1u, 2u, 3u, 0u};
+      break;
+    default:
+      return false;
+  }
+
+  for(int32_t y = area.y; y < area.y + area.height; ++y)
+  {
+    const uint8_t* sourcePixel = source.planes[0].ptr + y * source.planes[0].stride + static_cast<size_t>(area.x) * BYTES_PER_PIXEL;
+    for(int32_t x = 0; x < area.width; ++x)
+    {
+      destination[0] = sourcePixel[channelOffsets[0]];
+      destination[1] = sourcePixel[channelOffsets[1]];
+      destination[2] = sourcePixel[channelOffsets[2]];
+      destination[3] = sourcePixel[channelOffsets[3]];
+      sourcePixel += BYTES_PER_PIXEL;
+      destination += BYTES_PER_PIXEL;
+    }
+  }
+  return true;
+}
+
+constexpr int                     TBM_SURFACE_QUEUE_LENGTH    = 3;
+PFNEGLCREATESYNCKHRPROC           gEglCreateSyncKHR           = nullptr;
+PFNEGLDESTROYSYNCKHRPROC          gEglDestroySyncKHR          = nullptr;
+PFNEGLCLIENTWAITSYNCKHRPROC       gEglClientWaitSyncKHR       = nullptr;
+PFNEGLDUPNATIVEFENCEFDANDROIDPROC gEglDupNativeFenceFDANDROID = nullptr;
 
 std::string GetLanguage()
 {
@@ -104,9 +213,13 @@ WebEngineLweBackendTizen::WebEngineLweBackendTizen()
 #ifndef OVER_TIZEN_VERSION_9
 : mOutputWidth(0u),
   mOutputHeight(0u),
-  mOutputStride(0u),
-  mOutputBuffer(nullptr),
-  mTbmSurface(nullptr),
+  mOutputBufferCount(GetOutputBufferCount()),
+  mOutputQueue(nullptr),
+  mRenderingSurface(nullptr),
+  mDisplayedSurfaces(),
+  mLastRenderedSurface(nullptr),
+  mRenderedFrameNumber(0u),
+  mUpdatedAreaHistory(),
   mUpdateBufferTrigger(Dali::MakeCallback(this, &WebEngineLweBackendTizen::LegacyUpdateBuffer)),
   mWebContainer(nullptr),
 #else
@@ -119,6 +232,7 @@ WebEngineLweBackendTizen::WebEngineLweBackendTizen()
   mEglSurface(EGL_NO_SURFACE),
   mEglContext(EGL_NO_CONTEXT),
   mEglSync(nullptr),
+  mUseNativeFence(false),
   mTbmQueue(nullptr),
   mLastDrawnTbmSurface(nullptr),
   mIdleTbmSurface(nullptr),
@@ -126,19 +240,23 @@ WebEngineLweBackendTizen::WebEngineLweBackendTizen()
   mInImageUpdateState(false),
   mInIdleState(false),
   mFirstRenderEnded(false),
-  mDestroying(false)
+  mDestroying(false),
+  mRenderingEventTrigger(Dali::MakeCallback(this, &WebEngineLweBackendTizen::OnRenderingEvent)),
+  mWaitingForDequeue(false),
+  mWaitingForAcquire(false),
+  mRenderingDeferred(false),
+  mSyncWaiter(),
+  mSyncMutex(),
+  mSyncCondition(),
+  mPendingSync(nullptr),
+  mSyncSignaled(false),
+  mSyncWaiterStopping(false)
 {
-#ifndef OVER_TIZEN_VERSION_9
-  pthread_mutex_init(&mOutputBufferMutex, nullptr);
-#endif
 }
 
 WebEngineLweBackendTizen::~WebEngineLweBackendTizen()
 {
   Destroy();
-#ifndef OVER_TIZEN_VERSION_9
-  pthread_mutex_destroy(&mOutputBufferMutex);
-#endif
 }
 
 LWE::WebContainer* WebEngineLweBackendTizen::Create(uint32_t width, uint32_t height, uint32_t argc, char** argv)
@@ -175,12 +293,13 @@ LWE::WebContainer* WebEngineLweBackendTizen::Create(uint32_t width,
   mInImageUpdateState    = false;
   mInIdleState           = false;
   mFirstRenderEnded      = false;
+  mWaitingForDequeue     = false;
+  mWaitingForAcquire     = false;
+  mRenderingDeferred     = false;
 
 #ifndef OVER_TIZEN_VERSION_9
-  mOutputWidth  = width;
-  mOutputHeight = height;
-  mOutputStride = width * sizeof(uint32_t);
-  mOutputBuffer = nullptr;
+  mOutputWidth  = 0u;
+  mOutputHeight = 0u;
 #endif
 
   InitRenderingContext();
@@ -201,6 +320,10 @@ LWE::WebContainer* WebEngineLweBackendTizen::Create(uint32_t width,
   gEglDestroySyncKHR    = reinterpret_cast<PFNEGLDESTROYSYNCKHRPROC>(eglGetProcAddress("eglDestroySyncKHR"));
   gEglClientWaitSyncKHR = reinterpret_cast<PFNEGLCLIENTWAITSYNCKHRPROC>(eglGetProcAddress("eglClientWaitSyncKHR"));
 
+  gEglDupNativeFenceFDANDROID = reinterpret_cast<PFNEGLDUPNATIVEFENCEFDANDROIDPROC>(eglGetProcAddress("eglDupNativeFenceFDANDROID"));
+  const char* eglExtensions   = eglQueryString(mEglDisplay, EGL_EXTENSIONS);
+  mUseNativeFence             = gEglDupNativeFenceFDANDROID && eglExtensions && std::strstr(eglExtensions, "EGL_ANDROID_native_fence_sync");
+
 #ifdef OVER_TIZEN_VERSION_9
   LWE::WebContainer::WebContainerArguments arguments{
     .width            = static_cast<unsigned>(width),
@@ -225,7 +348,12 @@ LWE::WebContainer* WebEngineLweBackendTizen::Create(uint32_t width,
     {
       DALI_LOG_ERROR("WebEngineLwe: eglSwapBuffers failed: %d\n", static_cast<int>(eglGetError()));
     }
-    mEglSync = gEglCreateSyncKHR ? gEglCreateSyncKHR(mEglDisplay, EGL_SYNC_FENCE_KHR, nullptr) : nullptr;
+    mEglSync = gEglCreateSyncKHR ? gEglCreateSyncKHR(mEglDisplay, mUseNativeFence ? EGL_SYNC_NATIVE_FENCE_ANDROID : EGL_SYNC_FENCE_KHR, nullptr) : nullptr;
+    if(mEglSync && mUseNativeFence && gEglClientWaitSyncKHR)
+    {
+      // A native fence gets its sync file only when it is flushed.
+      gEglClientWaitSyncKHR(mEglDisplay, mEglSync, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, 0u);
+    }
     eglMakeCurrent(mEglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
     mLweRenderingRequested = false;
     TryUpdateImage(mayNeedSync);
@@ -277,8 +405,8 @@ LWE::WebContainer* WebEngineLweBackendTizen::Create(uint32_t width,
   });
   mWebContainer->LoadURL("about:blank");
 #else
-  mWebContainer = LWE::WebContainer::Create(mOutputWidth,
-                                             mOutputHeight,
+  mWebContainer = LWE::WebContainer::Create(width,
+                                             height,
                                              1.0,
                                              "",
                                              locale.data(),
@@ -287,59 +415,62 @@ LWE::WebContainer* WebEngineLweBackendTizen::Create(uint32_t width,
 
   mWebContainer->RegisterPreRenderingHandler([this]() -> LWE::WebContainer::RenderInfo
   {
-    if(!mOutputBuffer)
+    LWE::WebContainer::RenderInfo result;
+    result.updatedBufferAddress = nullptr;
+    result.bufferStride         = 0u;
+
+    tbm_surface_info_s surfaceInfo;
+    if(!mRenderingSurface)
     {
-      mOutputBuffer = static_cast<uint8_t*>(malloc(mOutputWidth * mOutputHeight * sizeof(uint32_t)));
-      mOutputStride = mOutputWidth * sizeof(uint32_t);
+      mRenderingSurface = DequeueOutputSurface(surfaceInfo);
+    }
+    else if(tbm_surface_get_info(mRenderingSurface, &surfaceInfo) != TBM_SURFACE_ERROR_NONE)
+    {
+      DALI_LOG_ERROR("WebEngineLwe: failed to get tbm_surface info\n");
+      return result;
     }
 
-    LWE::WebContainer::RenderInfo result;
-    result.updatedBufferAddress = mOutputBuffer;
-    result.bufferStride         = mOutputStride;
+    if(mRenderingSurface)
+    {
+      result.updatedBufferAddress = surfaceInfo.planes[0].ptr;
+      result.bufferStride         = surfaceInfo.planes[0].stride;
+    }
     return result;
   });
 
   mWebContainer->RegisterOnRenderedHandler(
     [this](LWE::WebContainer*, const LWE::WebContainer::RenderResult& renderResult)
   {
-    if(renderResult.updatedWidth != mOutputWidth || renderResult.updatedHeight != mOutputHeight || !mTbmSurface)
+    tbm_surface_h surface = mRenderingSurface;
+    mRenderingSurface     = nullptr;
+    if(!surface)
     {
       return;
     }
 
+    if(tbm_surface_unmap(surface) != TBM_SURFACE_ERROR_NONE)
     {
-      MutexLocker       lock(mOutputBufferMutex);
-      tbm_surface_info_s surfaceInfo;
-      if(tbm_surface_map(mTbmSurface, TBM_SURF_OPTION_READ | TBM_SURF_OPTION_WRITE, &surfaceInfo) != TBM_SURFACE_ERROR_NONE)
-      {
-        DALI_LOG_ERROR("WebEngineLwe: failed to map tbm_surface\n");
-        return;
-      }
-
-      DALI_ASSERT_ALWAYS(surfaceInfo.format == TBM_FORMAT_ARGB8888 && "Unsupported LWE TBM format");
-      const uint32_t sourceStride = static_cast<uint32_t>(renderResult.updatedWidth * sizeof(uint32_t));
-      auto*          source       = static_cast<uint8_t*>(renderResult.updatedBufferAddress);
-      auto*          destination  = static_cast<uint8_t*>(surfaceInfo.planes[0].ptr);
-      const size_t   targetStride = surfaceInfo.planes[0].stride;
-
-      if(targetStride == sourceStride)
-      {
-        std::memcpy(destination, source, surfaceInfo.planes[0].size);
-      }
-      else
-      {
-        for(size_t y = 0u; y < renderResult.updatedHeight; ++y)
-        {
-          std::memcpy(destination + y * targetStride, source + y * sourceStride, sourceStride);
-        }
-      }
+      DALI_LOG_ERROR("WebEngineLwe: failed to unmap tbm_surface\n");
+    }
 
-      if(tbm_surface_unmap(mTbmSurface) != TBM_SURFACE_ERROR_NONE)
-      {
-        DALI_LOG_ERROR("WebEngineLwe: failed to unmap tbm_surface\n");
-      }
+    // LWE repaints only the damaged rectangle; the rest of the surface was synchronized when it was dequeued.
+    // A frame outside of the surface belongs to the previous size and is dropped; the queue has been reset.
+    const size_t surfaceWidth  = static_cast<size_t>(tbm_surface_get_width(surface));
+    const size_t surfaceHeight = static_cast<size_t>(tbm_surface_get_height(surface));
+    if(renderResult.updatedX + renderResult.updatedWidth <= surfaceWidth &&
+       renderResult.updatedY + renderResult.updatedHeight <= surfaceHeight)
+    {
+      OnOutputSurfaceRendered(surface,
+                              Dali::Rect<int32_t>(static_cast<int32_t>(renderResult.updatedX),
+                                                  static_cast<int32_t>(renderResult.updatedY),
+                                                  static_cast<int32_t>(renderResult.updatedWidth),
+                                                  static_cast<int32_t>(renderResult.updatedHeight)));
+    }
+    else
+    {
+      tbm_surface_queue_cancel_dequeue(mOutputQueue, surface);
     }
-    mUpdateBufferTrigger.Trigger();
+    tbm_surface_internal_unref(surface);
   });
 
   SetSize(width, height);
@@ -364,16 +495,31 @@ void WebEngineLweBackendTizen::Destroy()
   DestroyRenderingContext();
 
 #ifndef OVER_TIZEN_VERSION_9
-  if(mTbmSurface)
+  if(mRenderingSurface)
   {
-    if(tbm_surface_destroy(mTbmSurface) != TBM_SURFACE_ERROR_NONE)
-    {
-      DALI_LOG_ERROR("WebEngineLwe: failed to destroy tbm_surface\n");
-    }
-    mTbmSurface = nullptr;
+    tbm_surface_unmap(mRenderingSurface);
+    tbm_surface_queue_cancel_dequeue(mOutputQueue, mRenderingSurface);
+    tbm_surface_internal_unref(mRenderingSurface);
+    mRenderingSurface = nullptr;
+  }
+  for(auto surface : mDisplayedSurfaces)
+  {
+    tbm_surface_queue_release(mOutputQueue, surface);
   }
-  free(mOutputBuffer);
-  mOutputBuffer = nullptr;
+  mDisplayedSurfaces.clear();
+  if(mLastRenderedSurface)
+  {
+    tbm_surface_internal_unref(mLastRenderedSurface);
+    mLastRenderedSurface = nullptr;
+  }
+  if(mOutputQueue)
+  {
+    tbm_surface_queue_destroy(mOutputQueue);
+    mOutputQueue = nullptr;
+  }
+  mOutputWidth         = 0u;
+  mOutputHeight        = 0u;
+  mRenderedFrameNumber = 0u;
 #endif
 
   mLweRenderingFunction = {};
@@ -381,6 +527,9 @@ void WebEngineLweBackendTizen::Destroy()
   mInImageUpdateState    = false;
   mInIdleState           = false;
   mFirstRenderEnded      = false;
+  mWaitingForDequeue     = false;
+  mWaitingForAcquire     = false;
+  mRenderingDeferred     = false;
 
   if(mIdleTbmSurface)
   {
@@ -400,23 +549,27 @@ void WebEngineLweBackendTizen::SetSize(uint32_t width, uint32_t height)
   }
 
 #ifndef OVER_TIZEN_VERSION_9
-  if(mOutputWidth != width || mOutputHeight != height || !mTbmSurface)
+  if(mOutputWidth != width || mOutputHeight != height || !mOutputQueue)
   {
     mOutputWidth  = width;
     mOutputHeight = height;
-    mOutputStride = width * sizeof(uint32_t);
 
-    tbm_surface_h previousSurface = mTbmSurface;
-    mTbmSurface                  = tbm_surface_create(width, height, TBM_FORMAT_ARGB8888);
-    mNativeImage->SetSource(Dali::Any(mTbmSurface));
-    if(previousSurface && tbm_surface_destroy(previousSurface) != TBM_SURFACE_ERROR_NONE)
+    const int queueWidth  = static_cast<int>(std::max(width, 1u));
+    const int queueHeight = static_cast<int>(std::max(height, 1u));
+    if(!mOutputQueue)
     {
-      DALI_LOG_ERROR("WebEngineLwe: failed to destroy previous tbm_surface\n");
+      mOutputQueue = tbm_surface_queue_create(static_cast<int>(mOutputBufferCount + RETAINED_OUTPUT_SURFACE_COUNT), queueWidth, queueHeight, TBM_FORMAT_ARGB8888, TBM_BO_DEFAULT);
+      DALI_ASSERT_ALWAYS(mOutputQueue && "Failed to create LWE output surface queue");
+    }
+    else
+    {
+      // The native image keeps its own reference to the displayed surface until the next frame.
+      mDisplayedSurfaces.clear();
+      if(tbm_surface_queue_reset(mOutputQueue, queueWidth, queueHeight, TBM_FORMAT_ARGB8888) != TBM_SURFACE_QUEUE_ERROR_NONE)
+      {
+        DALI_LOG_ERROR("WebEngineLwe: failed to reset output surface queue\n");
+      }
     }
-
-    auto* previousBuffer = mOutputBuffer;
-    mOutputBuffer        = static_cast<uint8_t*>(malloc(mOutputWidth * mOutputHeight * sizeof(uint32_t)));
-    free(previousBuffer);
   }
 #endif
 }
@@ -437,6 +590,42 @@ void WebEngineLweBackendTizen::SetFrameRenderedCallback(FrameRenderedCallback ca
   mFrameRenderedCallback = std::move(callback);
 }
 
+Dali::Devel::PixelBuffer WebEngineLweBackendTizen::CopyDisplayedFrame(const Dali::Rect<int32_t>& area)
+{
+  // The displayed surface is held by the backend, so LWE cannot render into it while it is read.
+#ifndef OVER_TIZEN_VERSION_9
+  tbm_surface_h surface = mDisplayedSurfaces.empty() ? nullptr : mDisplayedSurfaces.back();
+#else
+  tbm_surface_h surface = mLastDrawnTbmSurface ? mLastDrawnTbmSurface : mIdleTbmSurface;
+#endif
+  if(!surface)
+  {
+    return {};
+  }
+
+  Dali::Rect<int32_t> copiedArea = area;
+  if(!ClipToFrame(copiedArea, tbm_surface_get_width(surface), tbm_surface_get_height(surface)))
+  {
+    return {};
+  }
+
+  tbm_surface_info_s surfaceInfo;
+  if(tbm_surface_map(surface, TBM_SURF_OPTION_READ, &surfaceInfo) != TBM_SURFACE_ERROR_NONE)
+  {
+    DALI_LOG_ERROR("WebEngineLwe: failed to map tbm_surface\n");
+    return {};
+  }
+
+  auto pixelBuffer = Dali::Devel::PixelBuffer::New(copiedArea.width, copiedArea.height, Dali::Pixel::RGBA8888);
+  if(!CopyAreaAsRgba(surfaceInfo, copiedArea, pixelBuffer.GetBuffer()))
+  {
+    DALI_LOG_ERROR("WebEngineLwe: unsupported tbm_surface format for screenshot\n");
+    pixelBuffer.Reset();
+  }
+  tbm_surface_unmap(surface);
+  return pixelBuffer;
+}
+
 void WebEngineLweBackendTizen::DispatchToEventThread(Task task)
 {
   if(task)
@@ -485,6 +674,7 @@ void WebEngineLweBackendTizen::InitRenderingContext()
 void WebEngineLweBackendTizen::DestroyRenderingContext()
 {
   DestroyRenderingSurface();
+  StopSyncWaiter();
 
   if(mEglDisplay != EGL_NO_DISPLAY)
   {
@@ -525,6 +715,8 @@ void WebEngineLweBackendTizen::InitRenderingSurface()
                                        TBM_FORMAT_BGRA8888,
                                        TBM_BO_DEFAULT);
   DALI_ASSERT_ALWAYS(mTbmQueue && "Failed to create TBM surface queue");
+  tbm_surface_queue_add_dequeuable_cb(mTbmQueue, &WebEngineLweBackendTizen::OnQueueDequeuable, this);
+  tbm_surface_queue_add_acquirable_cb(mTbmQueue, &WebEngineLweBackendTizen::OnQueueAcquirable, this);
 
   mEglSurface = eglCreateWindowSurface(mEglDisplay,
                                        mEglConfig,
@@ -559,9 +751,18 @@ void WebEngineLweBackendTizen::DestroyRenderingSurface()
 
   if(mTbmQueue)
   {
+    tbm_surface_queue_remove_dequeuable_cb(mTbmQueue, &WebEngineLweBackendTizen::OnQueueDequeuable, this);
+    tbm_surface_queue_remove_acquirable_cb(mTbmQueue, &WebEngineLweBackendTizen::OnQueueAcquirable, this);
     tbm_surface_queue_destroy(mTbmQueue);
     mTbmQueue = nullptr;
   }
+
+  // Nothing will be dequeued or acquired from the destroyed queue.
+  mWaitingForDequeue = false;
+  if(mWaitingForAcquire.exchange(false))
+  {
+    FinishImageUpdate();
+  }
 }
 
 void WebEngineLweBackendTizen::TryRendering()
@@ -577,29 +778,27 @@ void WebEngineLweBackendTizen::TryRendering()
   {
     DestroyRenderingSurface();
   }
+  // The fence of the previous frame may still be waited for, so it must not be replaced yet.
+  if(mInImageUpdateState)
+  {
+    mRenderingDeferred = true;
+    return;
+  }
+
   InitRenderingSurface();
   OnActive();
 
-  unsigned waitCount = 0u;
-  while(!tbm_surface_queue_can_dequeue(mTbmQueue, 0) && waitCount < 10u)
+  // Set before checking, so a surface released in between still wakes us up.
+  mWaitingForDequeue = true;
+  if(!tbm_surface_queue_can_dequeue(mTbmQueue, 0))
   {
-    usleep(100u);
-    ++waitCount;
+    return;
   }
+  mWaitingForDequeue = false;
 
-  if(tbm_surface_queue_can_dequeue(mTbmQueue, 0))
-  {
-    if(mLweRenderingFunction)
-    {
-      mLweRenderingFunction();
-    }
-  }
-  else
+  if(mLweRenderingFunction)
   {
-    mWebContainer->AddIdleCallback([](void* data)
-    {
-      static_cast<WebEngineLweBackendTizen*>(data)->TryRendering();
-    }, this);
+    mLweRenderingFunction();
   }
 }
 
@@ -611,6 +810,19 @@ void WebEngineLweBackendTizen::TryUpdateImage(bool needsSync)
   }
 
   mInImageUpdateState = true;
+
+  bool syncSignaled = false;
+  {
+    std::lock_guard<std::mutex> lock(mSyncMutex);
+    if(mPendingSync)
+    {
+      // The waiter still uses the fence; this is called again when it hands the fence back.
+      return;
+    }
+    syncSignaled  = mSyncSignaled;
+    mSyncSignaled = false;
+  }
+
   if(!eglMakeCurrent(mEglDisplay, mEglSurface, mEglSurface, mEglContext))
   {
     DALI_LOG_ERROR("WebEngineLwe: eglMakeCurrent failed: %d\n", static_cast<int>(eglGetError()));
@@ -618,17 +830,15 @@ void WebEngineLweBackendTizen::TryUpdateImage(bool needsSync)
 
   if(mEglSync && gEglClientWaitSyncKHR)
   {
-    const auto state = gEglClientWaitSyncKHR(mEglDisplay,
-                                             mEglSync,
-                                             0,
-                                             needsSync ? EGL_FOREVER_KHR : 1000u * 1000u);
+    const auto state = syncSignaled ? EGL_CONDITION_SATISFIED_KHR : gEglClientWaitSyncKHR(mEglDisplay,
+                                                                                           mEglSync,
+                                                                                           0,
+                                                                                           needsSync ? EGL_FOREVER_KHR : 0u);
     if(state == EGL_TIMEOUT_EXPIRED_KHR)
     {
+      // The fence is waited for off the event thread, which calls this again once the frame is complete.
       eglMakeCurrent(mEglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
-      mWebContainer->AddIdleCallback([](void* data)
-      {
-        static_cast<WebEngineLweBackendTizen*>(data)->TryUpdateImage(false);
-      }, this);
+      WaitForSyncAsync();
       return;
     }
     if(gEglDestroySyncKHR)
@@ -640,39 +850,48 @@ void WebEngineLweBackendTizen::TryUpdateImage(bool needsSync)
 
   eglMakeCurrent(mEglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
 
-  unsigned waitCount = 0u;
-  while(!tbm_surface_queue_can_acquire(mTbmQueue, 0) && waitCount < 10u)
+  // Set before checking, so a surface enqueued in between still wakes us up.
+  mWaitingForAcquire = true;
+  if(!tbm_surface_queue_can_acquire(mTbmQueue, 0))
   {
-    usleep(100u);
-    ++waitCount;
+    return;
   }
+  mWaitingForAcquire = false;
 
-  if(tbm_surface_queue_can_acquire(mTbmQueue, 0))
+  if(!mFirstRenderEnded.exchange(true))
   {
-    if(!mFirstRenderEnded.exchange(true))
-    {
-      OnFirstRender();
-    }
+    OnFirstRender();
+  }
 
-    if(mLastDrawnTbmSurface)
-    {
-      tbm_surface_queue_release(mTbmQueue, mLastDrawnTbmSurface);
-      mLastDrawnTbmSurface = nullptr;
-    }
+  if(mLastDrawnTbmSurface)
+  {
+    tbm_surface_queue_release(mTbmQueue, mLastDrawnTbmSurface);
+    mLastDrawnTbmSurface = nullptr;
+  }
 
-    if(tbm_surface_queue_acquire(mTbmQueue, &mLastDrawnTbmSurface) == TBM_SURFACE_QUEUE_ERROR_NONE)
-    {
-      UpdateImage(mLastDrawnTbmSurface);
-      mInImageUpdateState = false;
-      return;
-    }
+  if(tbm_surface_queue_acquire(mTbmQueue, &mLastDrawnTbmSurface) == TBM_SURFACE_QUEUE_ERROR_NONE)
+  {
+    UpdateImage(mLastDrawnTbmSurface);
+  }
+  else
+  {
+    // The frame is dropped rather than retried, which would spin while the queue stays broken.
     DALI_LOG_ERROR("WebEngineLwe: failed to acquire TBM surface\n");
+    mLastDrawnTbmSurface = nullptr;
   }
+  FinishImageUpdate();
+}
 
-  mWebContainer->AddIdleCallback([](void* data)
+void WebEngineLweBackendTizen::FinishImageUpdate()
+{
+  mInImageUpdateState = false;
+  if(mRenderingDeferred.exchange(false) && mWebContainer)
   {
-    static_cast<WebEngineLweBackendTizen*>(data)->TryUpdateImage(false);
-  }, this);
+    mWebContainer->AddIdleCallback([](void* data)
+    {
+      static_cast<WebEngineLweBackendTizen*>(data)->TryRendering();
+    }, this);
+  }
 }
 
 void WebEngineLweBackendTizen::PrepareLweRendering()
@@ -682,12 +901,10 @@ void WebEngineLweBackendTizen::PrepareLweRendering()
     return;
   }
 
+  // Rendered by FinishImageUpdate(), rather than polling until the image is updated.
   if(mInImageUpdateState)
   {
-    mWebContainer->AddIdleCallback([](void* data)
-    {
-      static_cast<WebEngineLweBackendTizen*>(data)->PrepareLweRendering();
-    }, this);
+    mRenderingDeferred = true;
     return;
   }
 
@@ -697,6 +914,125 @@ void WebEngineLweBackendTizen::PrepareLweRendering()
   }, this);
 }
 
+void WebEngineLweBackendTizen::OnRenderingEvent()
+{
+  if(mDestroying || !mWebContainer)
+  {
+    return;
+  }
+
+  bool syncSignaled = false;
+  {
+    std::lock_guard<std::mutex> lock(mSyncMutex);
+    syncSignaled = mSyncSignaled;
+  }
+
+  // LWE is entered from its own idle callback, as everywhere else in this backend.
+  if(syncSignaled || mWaitingForAcquire.exchange(false))
+  {
+    mWebContainer->AddIdleCallback([](void* data)
+    {
+      static_cast<WebEngineLweBackendTizen*>(data)->TryUpdateImage(false);
+    }, this);
+  }
+  if(mWaitingForDequeue.exchange(false))
+  {
+    mWebContainer->AddIdleCallback([](void* data)
+    {
+      static_cast<WebEngineLweBackendTizen*>(data)->TryRendering();
+    }, this);
+  }
+}
+
+void WebEngineLweBackendTizen::OnQueueDequeuable(tbm_surface_queue_h, void* data)
+{
+  // Called on the thread which released the surface.
+  auto* backend = static_cast<WebEngineLweBackendTizen*>(data);
+  if(backend->mWaitingForDequeue)
+  {
+    backend->mRenderingEventTrigger.Trigger();
+  }
+}
+
+void WebEngineLweBackendTizen::OnQueueAcquirable(tbm_surface_queue_h, void* data)
+{
+  // Called on the thread which enqueued the surface.
+  auto* backend = static_cast<WebEngineLweBackendTizen*>(data);
+  if(backend->mWaitingForAcquire)
+  {
+    backend->mRenderingEventTrigger.Trigger();
+  }
+}
+
+void WebEngineLweBackendTizen::WaitForSyncAsync()
+{
+  {
+    std::lock_guard<std::mutex> lock(mSyncMutex);
+    if(!mSyncWaiter.joinable())
+    {
+      mSyncWaiterStopping = false;
+      mSyncWaiter         = std::thread(&WebEngineLweBackendTizen::RunSyncWaiter, this);
+    }
+    mPendingSync  = mEglSync;
+    mSyncSignaled = false;
+  }
+  mSyncCondition.notify_one();
+}
+
+void WebEngineLweBackendTizen::StopSyncWaiter()
+{
+  {
+    std::lock_guard<std::mutex> lock(mSyncMutex);
+    mSyncWaiterStopping = true;
+  }
+  mSyncCondition.notify_one();
+
+  // A fence always signals, so this waits at most for the frame being rendered.
+  if(mSyncWaiter.joinable())
+  {
+    mSyncWaiter.join();
+  }
+  mPendingSync  = nullptr;
+  mSyncSignaled = false;
+}
+
+void WebEngineLweBackendTizen::RunSyncWaiter()
+{
+  std::unique_lock<std::mutex> lock(mSyncMutex);
+  while(true)
+  {
+    mSyncCondition.wait(lock, [this]() { return mSyncWaiterStopping || mPendingSync; });
+    if(mSyncWaiterStopping)
+    {
+      return;
+    }
+
+    EGLSyncKHR sync = mPendingSync;
+    lock.unlock();
+
+    // A native fence is polled as a sync file; otherwise the driver blocks until the fence signals.
+    const int fenceFd = mUseNativeFence ? gEglDupNativeFenceFDANDROID(mEglDisplay, sync) : EGL_NO_NATIVE_FENCE_FD_ANDROID;
+    if(fenceFd != EGL_NO_NATIVE_FENCE_FD_ANDROID)
+    {
+      pollfd fenceEvent{fenceFd, POLLIN, 0};
+      while(poll(&fenceEvent, 1, -1) < 0 && errno == EINTR)
+      {
+      }
+      close(fenceFd);
+    }
+    else
+    {
+      gEglClientWaitSyncKHR(mEglDisplay, sync, 0, EGL_FOREVER_KHR);
+    }
+
+    // Hands the fence back; only now may the event thread destroy it.
+    lock.lock();
+    mPendingSync  = nullptr;
+    mSyncSignaled = true;
+    mRenderingEventTrigger.Trigger();
+  }
+}
+
 void WebEngineLweBackendTizen::OnIdle()
 {
   if(mInIdleState.exchange(true))
@@ -739,7 +1075,146 @@ void WebEngineLweBackendTizen::OnFirstRender()
 #ifndef OVER_TIZEN_VERSION_9
 void WebEngineLweBackendTizen::LegacyUpdateBuffer()
 {
-  UpdateImage(mTbmSurface);
+  if(!mOutputQueue)
+  {
+    return;
+  }
+
+  // Only the newest frame is displayed; older pending frames go back to LWE at once.
+  tbm_surface_h newestSurface = nullptr;
+  while(tbm_surface_queue_can_acquire(mOutputQueue, 0))
+  {
+    tbm_surface_h surface = nullptr;
+    if(tbm_surface_queue_acquire(mOutputQueue, &surface) != TBM_SURFACE_QUEUE_ERROR_NONE)
+    {
+      break;
+    }
+    if(newestSurface)
+    {
+      tbm_surface_queue_release(mOutputQueue, newestSurface);
+    }
+    newestSurface = surface;
+  }
+
+  if(!newestSurface)
+  {
+    return;
+  }
+
+  mDisplayedSurfaces.push_back(newestSurface);
+  while(mDisplayedSurfaces.size() > 1u + RETAINED_OUTPUT_SURFACE_COUNT)
+  {
+    tbm_surface_queue_release(mOutputQueue, mDisplayedSurfaces.front());
+    mDisplayedSurfaces.pop_front();
+  }
+  UpdateImage(newestSurface);
+}
+
+tbm_surface_h WebEngineLweBackendTizen::DequeueOutputSurface(tbm_surface_info_s& surfaceInfo)
+{
+  if(!mOutputQueue)
+  {
+    return nullptr;
+  }
+
+  // Never block LWE: if every surface is in use, the oldest frame still waiting for the event thread is dropped.
+  if(!tbm_surface_queue_can_dequeue(mOutputQueue, 0) && tbm_surface_queue_can_acquire(mOutputQueue, 0))
+  {
+    tbm_surface_h droppedSurface = nullptr;
+    if(tbm_surface_queue_acquire(mOutputQueue, &droppedSurface) == TBM_SURFACE_QUEUE_ERROR_NONE)
+    {
+      tbm_surface_queue_release(mOutputQueue, droppedSurface);
+    }
+  }
+
+  tbm_surface_h surface = nullptr;
+  if(!tbm_surface_queue_can_dequeue(mOutputQueue, 0) ||
+     tbm_surface_queue_dequeue(mOutputQueue, &surface) != TBM_SURFACE_QUEUE_ERROR_NONE || !surface)
+  {
+    DALI_LOG_ERROR("WebEngineLwe: failed to dequeue output tbm_surface\n");
+    return nullptr;
+  }
+
+  if(tbm_surface_map(surface, TBM_SURF_OPTION_READ | TBM_SURF_OPTION_WRITE, &surfaceInfo) != TBM_SURFACE_ERROR_NONE)
+  {
+    DALI_LOG_ERROR("WebEngineLwe: failed to map tbm_surface\n");
+    tbm_surface_queue_cancel_dequeue(mOutputQueue, surface);
+    return nullptr;
+  }
+  DALI_ASSERT_ALWAYS(surfaceInfo.format == TBM_FORMAT_ARGB8888 && "Unsupported LWE TBM format");
+
+  SynchronizeOutputSurface(surface, surfaceInfo);
+
+  // Keeps the surface alive while LWE renders into it, even if the queue is reset by a resize.
+  tbm_surface_internal_ref(surface);
+  return surface;
+}
+
+void WebEngineLweBackendTizen::SynchronizeOutputSurface(tbm_surface_h surface, const tbm_surface_info_s& surfaceInfo)
+{
+  // After a resize LWE repaints the whole surface, so there is nothing to bring over.
+  if(!mLastRenderedSurface || surface == mLastRenderedSurface ||
+     static_cast<uint32_t>(tbm_surface_get_width(mLastRenderedSurface)) != surfaceInfo.width ||
+     static_cast<uint32_t>(tbm_surface_get_height(mLastRenderedSurface)) != surfaceInfo.height)
+  {
+    return;
+  }
+
+  // Copies from the newest frame only what changed since the frame the surface holds.
+  const OutputSurfaceData* data = GetOutputSurfaceData(surface);
+  const uint32_t           age  = mRenderedFrameNumber - data->frameNumber;
+
+  Dali::Rect<int32_t> staleArea;
+  if(data->frameNumber == 0u || age > UPDATED_AREA_HISTORY_LENGTH)
+  {
+    staleArea = Dali::Rect<int32_t>(0, 0, static_cast<int32_t>(surfaceInfo.width), static_cast<int32_t>(surfaceInfo.height));
+  }
+  else
+  {
+    for(uint32_t frame = data->frameNumber + 1u; frame != mRenderedFrameNumber + 1u; ++frame)
+    {
+      MergeArea(staleArea, mUpdatedAreaHistory[frame % UPDATED_AREA_HISTORY_LENGTH]);
+    }
+  }
+
+  if(staleArea.IsEmpty())
+  {
+    return;
+  }
+
+  tbm_surface_info_s sourceInfo;
+  if(tbm_surface_map(mLastRenderedSurface, TBM_SURF_OPTION_READ, &sourceInfo) != TBM_SURFACE_ERROR_NONE)
+  {
+    DALI_LOG_ERROR("WebEngineLwe: failed to map tbm_surface\n");
+    return;
+  }
+  CopyArea(sourceInfo, surfaceInfo, staleArea);
+  tbm_surface_unmap(mLastRenderedSurface);
+}
+
+void WebEngineLweBackendTizen::OnOutputSurfaceRendered(tbm_surface_h surface, const Dali::Rect<int32_t>& updatedArea)
+{
+  if(++mRenderedFrameNumber == 0u)
+  {
+    ++mRenderedFrameNumber;
+  }
+  mUpdatedAreaHistory[mRenderedFrameNumber % UPDATED_AREA_HISTORY_LENGTH] = updatedArea;
+
+  GetOutputSurfaceData(surface)->frameNumber = mRenderedFrameNumber;
+
+  tbm_surface_internal_ref(surface);
+  if(mLastRenderedSurface)
+  {
+    tbm_surface_internal_unref(mLastRenderedSurface);
+  }
+  mLastRenderedSurface = surface;
+
+  if(tbm_surface_queue_enqueue(mOutputQueue, surface) != TBM_SURFACE_QUEUE_ERROR_NONE)
+  {
+    DALI_LOG_ERROR("WebEngineLwe: failed to enqueue output tbm_surface\n");
+    return;
+  }
+  mUpdateBufferTrigger.Trigger();
 }
 #endif
 
@@ -757,9 +1232,6 @@ void WebEngineLweBackendTizen::UpdateImage(tbm_surface_h image)
     return;
   }
 
-#ifndef OVER_TIZEN_VERSION_9
-  MutexLocker lock(mOutputBufferMutex);
-#endif
   mNativeImage->SetSource(Dali::Any(image));
   if(Dali::Adaptor::IsAvailable())
   {
@@ -27,10 +27,14 @@
 #include <tbm_surface.h>
 #include <tbm_surface_queue.h>
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
-#include <pthread.h>
+#include <mutex>
+#include <thread>
 
 namespace Dali
 {
@@ -49,11 +53,15 @@ public:
   void UpdateDisplayArea(uint32_t width, uint32_t height) override;
   Dali::NativeImagePtr GetNativeImage() override;
   void SetFrameRenderedCallback(FrameRenderedCallback callback) override;
+  Dali::Devel::PixelBuffer CopyDisplayedFrame(const Dali::Rect<int32_t>& area) override;
   void DispatchToEventThread(Task task) override;
 
 private:
 #ifndef OVER_TIZEN_VERSION_9
   void LegacyUpdateBuffer();
+  tbm_surface_h DequeueOutputSurface(tbm_surface_info_s& surfaceInfo);
+  void SynchronizeOutputSurface(tbm_surface_h surface, const tbm_surface_info_s& surfaceInfo);
+  void OnOutputSurfaceRendered(tbm_surface_h surface, const Dali::Rect<int32_t>& updatedArea);
 #endif
 
   void InitRenderingContext();
@@ -62,7 +70,14 @@ private:
   void DestroyRenderingSurface();
   void TryRendering();
   void TryUpdateImage(bool needsSync);
+  void FinishImageUpdate();
   void PrepareLweRendering();
+  void OnRenderingEvent();
+  void WaitForSyncAsync();
+  void StopSyncWaiter();
+  void RunSyncWaiter();
+  static void OnQueueDequeuable(tbm_surface_queue_h queue, void* data);
+  static void OnQueueAcquirable(tbm_surface_queue_h queue, void* data);
   void OnIdle();
   void OnActive();
   void OnFirstRender();
@@ -70,13 +85,21 @@ private:
 
 private:
 #ifndef OVER_TIZEN_VERSION_9
+  // Must cover the frames between two uses of a surface of the output queue.
+  static constexpr uint32_t UPDATED_AREA_HISTORY_LENGTH = 4u;
+
   size_t   mOutputWidth;
   size_t   mOutputHeight;
-  size_t   mOutputStride;
-  uint8_t* mOutputBuffer;
+  uint32_t mOutputBufferCount;
+
+  tbm_surface_queue_h       mOutputQueue;       // LWE renders directly into the dequeued surfaces
+  tbm_surface_h             mRenderingSurface;  // Mapped for LWE; accessed only on the LWE thread
+  std::deque<tbm_surface_h> mDisplayedSurfaces; // The newest one is set to the native image; accessed only on the event thread
 
-  pthread_mutex_t mOutputBufferMutex;
-  tbm_surface_h   mTbmSurface;
+  // Accessed only on the LWE thread
+  tbm_surface_h                                               mLastRenderedSurface;
+  uint32_t                                                    mRenderedFrameNumber;
+  std::array<Dali::Rect<int32_t>, UPDATED_AREA_HISTORY_LENGTH> mUpdatedAreaHistory;
 
   Dali::EventThreadCallback mUpdateBufferTrigger;
 #endif
@@ -90,6 +113,7 @@ private:
   EGLSurface           mEglSurface;
   EGLContext           mEglContext;
   EGLSyncKHR           mEglSync;
+  bool                 mUseNativeFence; // The fence of a frame is a sync file which can be polled
 
   tbm_surface_queue_h mTbmQueue;
   tbm_surface_h       mLastDrawnTbmSurface;
@@ -102,6 +126,20 @@ private:
   std::atomic_bool      mFirstRenderEnded;
   std::atomic_bool      mDestroying;
 
+  // Set on the event thread before waiting, and cleared by whoever wakes it up.
+  Dali::EventThreadCallback mRenderingEventTrigger;
+  std::atomic_bool          mWaitingForDequeue;
+  std::atomic_bool          mWaitingForAcquire;
+  std::atomic_bool          mRenderingDeferred; // Rendering was requested during an image update
+
+  // Waits for the fence of a frame off the event thread
+  std::thread             mSyncWaiter;
+  std::mutex              mSyncMutex;
+  std::condition_variable mSyncCondition;
+  EGLSyncKHR              mPendingSync;        // Owned by the waiter until it is handed back; mEglSync is not destroyed meanwhile
+  bool                    mSyncSignaled;       // Set by the waiter when it hands the fence back
+  bool                    mSyncWaiterStopping;
+
   FrameRenderedCallback mFrameRenderedCallback;
 };
 
@@ -175,6 +175,7 @@ void WebEngineLweBackendWin::Destroy()
   mRenderBuffer.clear();
   mRenderWidth  = 0u;
   mRenderHeight = 0u;
+  mImageBuffer.clear();
 }
 
 void WebEngineLweBackendWin::SetSize(uint32_t width, uint32_t height)
@@ -202,6 +203,33 @@ void WebEngineLweBackendWin::SetFrameRenderedCallback(FrameRenderedCallback call
   mFrameRenderedCallback = std::move(callback);
 }
 
+Dali::Devel::PixelBuffer WebEngineLweBackendWin::CopyDisplayedFrame(const Dali::Rect<int32_t>& area)
+{
+  Dali::Rect<int32_t> copiedArea = area;
+  if(mImageBuffer.empty() || !ClipToFrame(copiedArea, mImageWidth, mImageHeight))
+  {
+    return {};
+  }
+
+  auto     pixelBuffer = Dali::Devel::PixelBuffer::New(copiedArea.width, copiedArea.height, Dali::Pixel::RGBA8888);
+  uint8_t* destination = pixelBuffer.GetBuffer();
+  for(int32_t y = copiedArea.y; y < copiedArea.y + copiedArea.height; ++y)
+  {
+    const uint8_t* source = mImageBuffer.data() + (static_cast<size_t>(y) * mImageWidth + copiedArea.x) * BYTES_PER_PIXEL;
+    for(int32_t x = 0; x < copiedArea.width; ++x)
+    {
+      // RENDER_BUFFER_PIXEL_FORMAT is BGRA8888.
+      destination[0] = source[2];
+      destination[1] = source[1];
+      destination[2] = source[0];
+      destination[3] = source[3];
+      source += BYTES_PER_PIXEL;
+      destination += BYTES_PER_PIXEL;
+    }
+  }
+  return pixelBuffer;
+}
+
 void WebEngineLweBackendWin::DispatchToEventThread(Task task)
 {
   if(!task || !mAcceptTasks)
@@ -273,6 +301,7 @@ void WebEngineLweBackendWin::UploadFrame()
   }
 
   Dali::DevelNativeImage::SetPixels(*mNativeImage, pixels.data(), RENDER_BUFFER_PIXEL_FORMAT);
+  mImageBuffer.swap(pixels);
   if(mFrameRenderedCallback)
   {
     mFrameRenderedCallback();
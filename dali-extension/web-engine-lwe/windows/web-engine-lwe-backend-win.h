@@ -44,6 +44,7 @@ public:
   void UpdateDisplayArea(uint32_t width, uint32_t height) override;
   Dali::NativeImagePtr GetNativeImage() override;
   void SetFrameRenderedCallback(FrameRenderedCallback callback) override;
+  Dali::Devel::PixelBuffer CopyDisplayedFrame(const Dali::Rect<int32_t>& area) override;
   void DispatchToEventThread(Task task) override;
 
 private:
@@ -71,6 +72,7 @@ private:
   Dali::NativeImagePtr mNativeImage;
   uint32_t             mImageWidth;
   uint32_t             mImageHeight;
+  std::vector<uint8_t> mImageBuffer; // Pixels last set to the native image, kept for screenshots
 
   std::mutex        mTaskMutex;
   std::deque<Task>  mTasks;